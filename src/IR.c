@@ -1,24 +1,61 @@
-#include "ir.h"
+#include "IR.h"
 #include "list.h"
 #include "utils.h"
+#include "emit.h"
 
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
-// void initIR(IR *ir) {
-//     ir->count = 0;
-//     ir->capacity = 10;
-//     ir->instructions = (IRLine *)malloc(sizeof(IRLine) * ir->capacity);
-//     if (!ir->instructions) {
-//         fprintf(stderr, "Error: Memory allocation failed for IR instructions.\n");
-//         exit(EXIT_FAILURE);
-//     }
-// }
+#define IR_INITIAL_CAPACITY 64
+
+// Applies X to the field name of every IR column
+#define IR_COLUMNS(X) \
+    X(opcode) X(flags) X(imm) \
+    X(src1.sr) X(src1.vr) X(src1.pr) X(src1.nu) \
+    X(src2.sr) X(src2.vr) X(src2.pr) X(src2.nu) \
+    X(dst.sr) X(dst.vr) X(dst.pr) X(dst.nu)
+
+static void *growColumn(void *column, int capacity, size_t width) {
+    void *grown = realloc(column, (size_t)capacity * width);
+    if (!grown) {
+        printf("Error: Memory allocation failed for IR instructions.\n");
+        exit(EXIT_FAILURE);
+    }
+    return grown;
+}
+
+// Points every operand slot at the shared flag byte
+static void bindOperandFlags(IR *ir) {
+    ir->src1.flags = ir->src2.flags = ir->dst.flags = ir->flags;
+    ir->src1.dirtyBit = 0x01;
+    ir->src1.spilledBit = 0x02;
+    ir->src2.dirtyBit = 0x04;
+    ir->src2.spilledBit = 0x08;
+    ir->dst.dirtyBit = 0x10;
+    ir->dst.spilledBit = 0x20;
+}
+
+// Makes room for at least capacity instructions in every column
+static void reserveIR(IR *ir, int capacity) {
+    if (capacity <= ir->capacity) {
+        return;
+    }
+    int newCapacity = ir->capacity ? ir->capacity : IR_INITIAL_CAPACITY;
+    while (newCapacity < capacity) {
+        newCapacity *= 2;
+    }
+#define GROW_COLUMN(field) ir->field = growColumn(ir->field, newCapacity, sizeof(*ir->field));
+    IR_COLUMNS(GROW_COLUMN)
+#undef GROW_COLUMN
+    bindOperandFlags(ir);
+    ir->capacity = newCapacity;
+}
 
 void initIR(IR *ir) {
-    ir->instructions = emptyList();  // Initialize as an empty list
-    ir->count = 0;
+    *ir = (IR){0};  // Columns are allocated on the first addToIR
+    initArena(&ir->arena, 0);
     //printf("IR initialized.\n");
 }
 
@@ -39,232 +76,160 @@ void initIRLine(IRLine *line) {
     line->dst.sr = -1;
     line->dst.vr = -1;
     line->dst.nu = INT_MAX;
+    line->dst.imm = 0;
     line->dst.dirty = 1;
+
+    line->src1.pr = line->src2.pr = line->dst.pr = -1;
+    line->src1.spilled = line->src2.spilled = line->dst.spilled = 0;
+    line->index = -1;
 }
 
 
-// void addToIR(IR *ir, IRLine line) {
-//     // Ensure IRLine fields are initialized to avoid carryover issues
-//     line.src1.sr = line.src1.sr != -1 ? line.src1.sr : -1;
-//     line.src2.sr = line.src2.sr != -1 ? line.src2.sr : -1;
-//     line.dst.sr = line.dst.sr != -1 ? line.dst.sr : -1;
-
-//     if (ir->count >= ir->capacity) {
-//         printf("Increasing IR capacity...\n");
-//         ir->capacity *= 2;
-//         ir->instructions = (IRLine *)realloc(ir->instructions, sizeof(IRLine) * ir->capacity);
-//         if (!ir->instructions) {
-//             printf("Error: Failed to reallocate memory for IR instructions\n");
-//             exit(EXIT_FAILURE);
-//         }
-//     }
-
-//     // Debug statement for opcode and operands being added
-//     printf("Adding to IR: Opcode = %s, Src1 = r%d, Src2 = r%d, Dst = r%d\n", 
-//            opcodeToString(line.opcode), 
-//            line.src1.sr, 
-//            line.src2.sr, 
-//            line.dst.sr);
-
-//     ir->instructions[ir->count++] = line;
-// }
+static inline void storeOperand(OperandColumns *op, int i, const Operand *value) {
+    op->sr[i] = value->sr;
+    op->vr[i] = value->vr;
+    op->pr[i] = (short)value->pr;
+    op->nu[i] = value->nu;
+    setOperandSpilled(op, i, value->spilled);
+    setOperandDirty(op, i, value->dirty);
+}
+
+static inline Operand loadOperand(const OperandColumns *op, int i) {
+    return (Operand){
+        .sr = op->sr[i], .vr = op->vr[i], .pr = op->pr[i], .imm = 0,
+        .nu = op->nu[i], .spilled = operandSpilled(op, i), .dirty = operandDirty(op, i)
+    };
+}
 
 void addToIR(IR *ir, IRLine line) {
-    if (!ir || !ir->instructions) {
-        printf("Error: IR or instructions list is NULL.\n");
+    if (!ir) {
+        printf("Error: IR is NULL.\n");
         exit(EXIT_FAILURE);
     }
+    reserveIR(ir, ir->count + 1);
+    setIRLine(ir, ir->count, &line);
+    ir->count++;
+}
+
+// Gathers instruction i from the columns into a standalone IRLine
+IRLine getIRLine(const IR *ir, int i) {
+    IRLine line;
+    line.opcode = ir->opcode[i];
+    line.index = i;
+    line.src1 = loadOperand(&ir->src1, i);
+    line.src2 = loadOperand(&ir->src2, i);
+    line.dst = loadOperand(&ir->dst, i);
+    line.src1.imm = ir->imm[i];
+    return line;
+}
+
+// Scatters line into the columns at position i. Only src1.imm is kept: no
+// instruction carries more than one immediate.
+void setIRLine(IR *ir, int i, const IRLine *line) {
+    ir->opcode[i] = (unsigned char)line->opcode;
+    ir->flags[i] = 0;
+    ir->imm[i] = line->src1.imm;
+    storeOperand(&ir->src1, i, &line->src1);
+    storeOperand(&ir->src2, i, &line->src2);
+    storeOperand(&ir->dst, i, &line->dst);
+}
 
-    // Allocate memory for the new instruction
-    IRLine *newLine = (IRLine *)malloc(sizeof(IRLine));
-    if (!newLine) {
-        printf("Error: Memory allocation failed for new instruction.\n");
+// Copies every instruction of other onto the end of ir; other is left freed and empty
+void appendIR(IR *ir, IR *other) {
+    if (!ir || !other) {
+        printf("Error: IR is NULL.\n");
         exit(EXIT_FAILURE);
     }
-    *newLine = line;
 
-    // Use the append function to add the new instruction to the list
-    append(ir->instructions, newLine);
-
-    // Increment the IR count
-    ir->count++;
+    if (other->count > 0) {
+        reserveIR(ir, ir->count + other->count);
+#define APPEND_COLUMN(field) memcpy(ir->field + ir->count, other->field, other->count * sizeof(*ir->field));
+        IR_COLUMNS(APPEND_COLUMN)
+#undef APPEND_COLUMN
+        ir->count += other->count;
+    }
+    freeIR(other);
+}
 
-    // Debug: Print the list size after addition
-    //printf("List size after addToIR: %d\n", size(ir->instructions));
+int compactIR(IR *ir, const char *keep) {
+    int kept = 0;
+    for (int i = 0; i < ir->count; i++) {
+        if (!keep[i]) {
+            continue;
+        }
+        if (kept != i) {
+#define MOVE_ROW(field) ir->field[kept] = ir->field[i];
+            IR_COLUMNS(MOVE_ROW)
+#undef MOVE_ROW
+        }
+        kept++;
+    }
+    int removed = ir->count - kept;
+    ir->count = kept;
+    return removed;
 }
 
+// Builds a linked-list view of the IR holding copies of each instruction.
+// Nodes and lines come from the IR's arena and are released by freeIR, not freeList.
+List *irToList(IR *ir) {
+    List *list = (List *)arenaAlloc(&ir->arena, sizeof(List));
+    *list = (List){.head = NULL, .next = NULL, .prev = NULL, .tail = list};
+
+    List *nodes = (List *)arenaAlloc(&ir->arena, (size_t)ir->count * sizeof(List));
+    IRLine *lines = (IRLine *)arenaAlloc(&ir->arena, (size_t)ir->count * sizeof(IRLine));
+    for (int i = 0; i < ir->count; i++) {
+        lines[i] = getIRLine(ir, i);
+        nodes[i] = (List){.head = &lines[i], .next = NULL, .prev = list->tail, .tail = NULL};
+        list->tail->next = &nodes[i];
+        list->tail = &nodes[i];
+    }
+    return list;
+}
 
-int getMaxSR(List *instructions) {
-    if (!instructions) {
-        printf("Error: Instructions list is NULL\n");
+int getMaxSR(const IR *ir) {
+    if (!ir) {
+        printf("Error: IR is NULL\n");
         return -1;
     }
 
     int maxSR = 0;  
-    List *current = instructions->next;  
-
-    while (current) {
-        IRLine *line = current->head;
-        if (line) {
-            if (line->src1.sr != -1) {
-                maxSR = (line->src1.sr > maxSR) ? line->src1.sr : maxSR;
-            }
-            if (line->src2.sr != -1) {
-                maxSR = (line->src2.sr > maxSR) ? line->src2.sr : maxSR;
-            }
-            if (line->dst.sr != -1) {
-                maxSR = (line->dst.sr > maxSR) ? line->dst.sr : maxSR;
-            }
-        }
-        current = current->next;
+    for (int i = 0; i < ir->count; i++) {
+        if (ir->src1.sr[i] > maxSR) maxSR = ir->src1.sr[i];
+        if (ir->src2.sr[i] > maxSR) maxSR = ir->src2.sr[i];
+        if (ir->dst.sr[i] > maxSR) maxSR = ir->dst.sr[i];
     }
 
     return maxSR+1;
 }
 
-// void printIR(IR *ir, PrintMode mode) {
-//     for (int i = 0; i < ir->count; i++) {
-//         IRLine *line = &ir->instructions[i];
-//         switch (mode) {
-//             case PRETTY_PRINT:
-//                 prettyPrintInstruction(line);
-//                 break;
-//             case TABLE_PRINT:
-//                 printInstructionTable(line);
-//                 break;
-//         }
-//     }
-// }
-
 void printIR(IR *ir, PrintMode mode) {
-    List *current = ir->instructions->next;  // Use List consistently
-
-    while (current != NULL) {
-        IRLine *line = current->head;
-        if (line) {
-            switch (mode) {
-                case PRETTY_PRINT:
-                    prettyPrintInstruction(line);
-                    break;
-                case TABLE_PRINT:
-                    printInstructionTable(line);
-                    break;
-            }
-        }
-        current = current->next;
+    if (mode == PRETTY_PRINT) {
+        emitIR(ir, EMIT_SR, stdout, 1);
+        return;
+    }
+    for (int i = 0; i < ir->count; i++) {
+        IRLine line = getIRLine(ir, i);
+        printInstructionTable(&line);
     }
 }
 
+// Formats one detached instruction with the given register numbers and writes it to stdout
+static void printInstructionLine(IRLine *line, int r1, int r2, int rd) {
+    char text[EMIT_MAX_LINE];
+    char *end = formatInstruction(text, line->opcode, line->src1.imm, r1, r2, rd);
+    fwrite(text, 1, (size_t)(end - text), stdout);
+}
 
 void prettyPrintInstruction(IRLine *line) {
-    switch (line->opcode) {
-        case LOADI:
-            printf("loadI %d => r%d\n", line->src1.imm, line->dst.sr);
-            break;
-        case LOAD:
-            printf("load r%d => r%d\n", line->src1.sr, line->dst.sr);
-            break;
-        case STORE:
-            printf("store r%d => r%d\n", line->src1.sr, line->src2.sr);
-            break;
-        case ADD:
-            printf("add r%d, r%d => r%d\n", line->src1.sr, line->src2.sr, line->dst.sr);
-            break;
-        case SUB:
-            printf("sub r%d, r%d => r%d\n", line->src1.sr, line->src2.sr, line->dst.sr);
-            break;
-        case MULT:
-            printf("mult r%d, r%d => r%d\n", line->src1.sr, line->src2.sr, line->dst.sr);
-            break;
-        case LSHIFT:
-            printf("lshift r%d, r%d => r%d\n", line->src1.sr, line->src2.sr, line->dst.sr);
-            break;
-        case RSHIFT:
-            printf("lshift r%d, r%d => r%d\n", line->src1.sr, line->src2.sr, line->dst.sr);
-            break;
-        case OUTPUT:
-            printf("output %d\n", line->src1.imm);
-            break;
-        case NOP:
-            printf("nop\n");
-            break;
-        default:
-            printf("Unknown instruction\n");
-    }
+    printInstructionLine(line, line->src1.sr, line->src2.sr, line->dst.sr);
 }
 
 void prettyPrintInstructionPRs(IRLine *line) {
-    switch (line->opcode) {
-        case LOADI:
-            printf("loadI %d => r%d\n", line->src1.imm, line->dst.pr);
-            break;
-        case LOAD:
-            printf("load r%d => r%d\n", line->src1.pr, line->dst.pr);
-            break;
-        case STORE:
-            printf("store r%d => r%d\n", line->src1.pr, line->src2.pr);
-            break;
-        case ADD:
-            printf("add r%d, r%d => r%d\n", line->src1.pr, line->src2.pr, line->dst.pr);
-            break;
-        case SUB:
-            printf("sub r%d, r%d => r%d\n", line->src1.pr, line->src2.pr, line->dst.pr);
-            break;
-        case MULT:
-            printf("mult r%d, r%d => r%d\n", line->src1.pr, line->src2.pr, line->dst.pr);
-            break;
-        case LSHIFT:
-            printf("lshift r%d, r%d => r%d\n", line->src1.pr, line->src2.pr, line->dst.pr);
-            break;
-        case RSHIFT:
-            printf("lshift r%d, r%d => r%d\n", line->src1.pr, line->src2.pr, line->dst.pr);
-            break;
-        case OUTPUT:
-            printf("output %d\n", line->src1.imm);
-            break;
-        case NOP:
-            printf("nop\n");
-            break;
-        default:
-            printf("Unknown instruction\n");
-    }
+    printInstructionLine(line, line->src1.pr, line->src2.pr, line->dst.pr);
 }
 
 void prettyPrintInstructionVRs(IRLine *line) {
-    switch (line->opcode) {
-        case LOADI:
-            printf("loadI %d => r%d\n", line->src1.imm, line->dst.vr);
-            break;
-        case LOAD:
-            printf("load r%d => r%d\n", line->src1.vr, line->dst.vr);
-            break;
-        case STORE:
-            printf("store r%d => r%d\n", line->src1.vr, line->src2.vr);
-            break;
-        case ADD:
-            printf("add r%d, r%d => r%d\n", line->src1.vr, line->src2.vr, line->dst.vr);
-            break;
-        case SUB:
-            printf("sub r%d, r%d => r%d\n", line->src1.vr, line->src2.vr, line->dst.vr);
-            break;
-        case MULT:
-            printf("mult r%d, r%d => r%d\n", line->src1.vr, line->src2.vr, line->dst.vr);
-            break;
-        case LSHIFT:
-            printf("lshift r%d, r%d => r%d\n", line->src1.vr, line->src2.vr, line->dst.vr);
-            break;
-        case RSHIFT:
-            printf("lshift r%d, r%d => r%d\n", line->src1.vr, line->src2.vr, line->dst.vr);
-            break;
-        case OUTPUT:
-            printf("output %d\n", line->src1.imm);
-            break;
-        case NOP:
-            printf("nop\n");
-            break;
-        default:
-            printf("Unknown instruction\n");
-    }
+    printInstructionLine(line, line->src1.vr, line->src2.vr, line->dst.vr);
 }
 
 void printInstructionTable(IRLine *line) {
@@ -281,6 +246,25 @@ void printInstructionTable(IRLine *line) {
                    line->src1.sr,
                    line->src2.sr);
             break;
+        case ADDI:
+        case SUBI:
+        case MULTI:
+        case LSHIFTI:
+        case RSHIFTI:
+        case LOADAI:
+            printf("| %-6s | r%-3d | %-4d | => | r%-3d |\n",
+                   opcodeToString(line->opcode),
+                   line->src1.sr,
+                   line->src1.imm,
+                   line->dst.sr);
+            break;
+        case STOREAI:
+            printf("| %-6s | r%-3d | -    | => | r%-3d | %-4d |\n",
+                   opcodeToString(line->opcode),
+                   line->src1.sr,
+                   line->src2.sr,
+                   line->src1.imm);
+            break;
         case OUTPUT:
             printf("| %-6s | %-4d | -    | => | -    |\n",
                    opcodeToString(line->opcode),
@@ -300,22 +284,21 @@ void printInstructionTable(IRLine *line) {
 }
 
 void freeIR(IR *ir) {
-    freeList(ir->instructions);  // Free the linked list of instructions
-    ir->count = 0;               // Reset the count
+#define FREE_COLUMN(field) free(ir->field);
+    IR_COLUMNS(FREE_COLUMN)
+#undef FREE_COLUMN
+    freeArena(&ir->arena);
+    *ir = (IR){0};  // Reset the count and capacity
 }
 
 const char* opcodeToString(OpcodeType opcode) {
-    switch (opcode) {
-        case LOADI: return "loadI";
-        case LOAD:  return "load";
-        case STORE: return "store";
-        case ADD:   return "add";
-        case SUB:   return "sub";
-        case MULT:  return "mult";
-        case LSHIFT: return "lshift"; 
-        case RSHIFT: return "rshift";   
-        case OUTPUT: return "output";
-        case NOP:   return "nop";
-        default:    return "unknown";
+    static const char *names[] = {
+#define X(name, text) text,
+        OPCODE_TABLE(X)
+#undef X
+    };
+    if ((int)opcode < 0 || opcode >= OPCODE_COUNT) {
+        return "unknown";
     }
+    return names[opcode];
 }
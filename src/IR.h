@@ -3,6 +3,7 @@
 #include <limits.h>
 #include "list.h"
 #include "opcodes.h"
+#include "arena.h"
 
 // Operand structure
 typedef struct Operand {
@@ -24,12 +25,51 @@ typedef struct IRLine {
     int index;         // Original instruction index (for debugging)
 } IRLine;
 
-// IR structure
+// One operand slot of every instruction, stored column-wise (entry i belongs to instruction i)
+typedef struct OperandColumns {
+    int *sr;                // Source register numbers
+    int *vr;                // Virtual register numbers
+    short *pr;              // Physical register numbers (k is capped at IR_MAX_PR)
+    int *nu;                // Next uses
+    unsigned char *flags;   // Shared per-instruction flag byte (same pointer as IR.flags)
+    unsigned char dirtyBit;   // This slot's dirty bit within flags
+    unsigned char spilledBit; // This slot's spilled bit within flags
+} OperandColumns;
+
+#define IR_MAX_PR SHRT_MAX
+
+// IR structure: instructions live in growable contiguous arrays so passes index by position.
+// Each instruction costs 48 bytes: a 1-byte opcode, one flag byte holding the dirty and
+// spilled bits of all three operands, a single immediate, and sr/vr/nu/pr per operand.
 typedef struct IR {
-    List *instructions;  // List of IRLine instructions
-    int count;           // Number of instructions
+    int count;               // Number of instructions
+    int capacity;            // Allocated length of every column
+    unsigned char *opcode;   // Instruction opcodes
+    unsigned char *flags;    // Dirty/spilled bits for src1, src2 and dst
+    int *imm;                // The instruction's immediate (loadI constant, output address)
+    OperandColumns src1;     // First source operand of each instruction
+    OperandColumns src2;     // Second source operand of each instruction
+    OperandColumns dst;      // Destination operand of each instruction
+    Arena arena;             // Storage for list views, released with the IR
 } IR;
 
+// Accessors for the packed fields
+static inline int operandDirty(const OperandColumns *op, int i) {
+    return (op->flags[i] & op->dirtyBit) != 0;
+}
+
+static inline void setOperandDirty(OperandColumns *op, int i, int dirty) {
+    op->flags[i] = dirty ? (op->flags[i] | op->dirtyBit) : (op->flags[i] & ~op->dirtyBit);
+}
+
+static inline int operandSpilled(const OperandColumns *op, int i) {
+    return (op->flags[i] & op->spilledBit) != 0;
+}
+
+static inline void setOperandSpilled(OperandColumns *op, int i, int spilled) {
+    op->flags[i] = spilled ? (op->flags[i] | op->spilledBit) : (op->flags[i] & ~op->spilledBit);
+}
+
 // Function declarations
 typedef enum {
     PRETTY_PRINT,
@@ -39,9 +79,14 @@ typedef enum {
 void initIR(IR *ir);
 void initIRLine(IRLine *line);
 void addToIR(IR *ir, IRLine line);
+void appendIR(IR *ir, IR *other);
+IRLine getIRLine(const IR *ir, int i);
+void setIRLine(IR *ir, int i, const IRLine *line);
+int compactIR(IR *ir, const char *keep);  // Drops every instruction i with !keep[i]; returns how many
+List *irToList(IR *ir);
 void printIR(IR *ir, PrintMode mode);
 void freeIR(IR *ir);
-int getMaxSR(List *instructions);
+int getMaxSR(const IR *ir);
 
 void prettyPrintInstruction(IRLine *line);
 void prettyPrintInstructionPRs(IRLine *line);
@@ -0,0 +1,106 @@
+#include "alias.h"
+#include "fold.h"
+#include "opcodes.h"
+#include "utils.h"
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+void initAddressMap(AddressMap *map, int expected) {
+    size_t size = 64;
+    while (size < (size_t)expected * 2) {
+        size *= 2;
+    }
+    map->keys = (int *)malloc(size * sizeof(int));
+    map->values = (int *)malloc(size * sizeof(int));
+    assertCondition(map->keys != NULL && map->values != NULL, "Failed to allocate address map");
+    for (size_t i = 0; i < size; i++) {
+        map->keys[i] = ADDRESS_UNKNOWN;
+    }
+    map->mask = size - 1;
+}
+
+static size_t addressSlot(const AddressMap *map, int address) {
+    size_t slot = (size_t)(((uint64_t)(unsigned)address * 0x9E3779B97F4A7C15ULL) >> 32) & map->mask;
+    while (map->keys[slot] != ADDRESS_UNKNOWN && map->keys[slot] != address) {
+        slot = (slot + 1) & map->mask;
+    }
+    return slot;
+}
+
+// The map is sized for every distinct address of the block up front, so it never grows
+int *addressEntry(AddressMap *map, int address) {
+    size_t slot = addressSlot(map, address);
+    if (map->keys[slot] == ADDRESS_UNKNOWN) {
+        map->keys[slot] = address;
+        map->values[slot] = -1;
+    }
+    return &map->values[slot];
+}
+
+int addressValue(const AddressMap *map, int address) {
+    if (address < 0) {
+        return -1;
+    }
+    size_t slot = addressSlot(map, address);
+    return map->keys[slot] == address ? map->values[slot] : -1;
+}
+
+void freeAddressMap(AddressMap *map) {
+    free(map->keys);
+    free(map->values);
+}
+
+void computeAddresses(const IR *ir, int *address) {
+    ConstantTable constants;
+    initConstantTable(&constants, ir);
+
+    for (int i = 0; i < ir->count; i++) {
+        int op = ir->opcode[i];
+        address[i] = ADDRESS_UNKNOWN;
+        int base = isStoreOp(op) ? ir->src2.sr[i] : ir->src1.sr[i];
+        long long offset = (op == LOADAI || op == STOREAI) ? ir->imm[i] : 0;
+        if ((isLoadOp(op) || isStoreOp(op)) && base != -1 && constants.known[base] &&
+            constants.value[base] + offset <= INT_MAX) {
+            address[i] = (int)(constants.value[base] + offset);
+        } else if (op == OUTPUT) {
+            address[i] = ir->imm[i];
+        }
+        defineConstant(&constants, ir, i);
+    }
+
+    freeConstantTable(&constants);
+}
+
+void computeNextClobber(const IR *ir, const int *address, int *next) {
+    AddressMap stores;  // Nearest later store to each known address
+    initAddressMap(&stores, ir->count);
+    int nextUnknownStore = INT_MAX;
+    int nextStore = INT_MAX;
+
+    for (int i = ir->count - 1; i >= 0; i--) {
+        if (isStoreOp(ir->opcode[i])) {
+            nextStore = i;
+            if (address[i] == ADDRESS_UNKNOWN) {
+                nextUnknownStore = i;
+            } else {
+                *addressEntry(&stores, address[i]) = i;
+            }
+        } else if (isLoadOp(ir->opcode[i])) {
+            if (address[i] == ADDRESS_UNKNOWN) {
+                next[i] = nextStore;
+                continue;
+            }
+            // Any store overlapping the loaded word counts, not just one to the same address
+            next[i] = nextUnknownStore;
+            for (int a = address[i] - (WORD_BYTES - 1); a <= address[i] + (WORD_BYTES - 1); a++) {
+                int store = addressValue(&stores, a);
+                if (store != -1 && store < next[i]) {
+                    next[i] = store;
+                }
+            }
+        }
+    }
+
+    freeAddressMap(&stores);
+}
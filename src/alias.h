@@ -0,0 +1,45 @@
+#ifndef ALIAS_H
+#define ALIAS_H
+
+#include <stddef.h>
+#include "IR.h"
+
+#define ADDRESS_UNKNOWN -1  // Addresses are non-negative, so this never names a real one
+#define WORD_BYTES 4        // Width of every memory access
+
+// Whether two accesses may touch the same word; an unknown address may touch any
+static inline int mayAlias(int a, int b) {
+    if (a == ADDRESS_UNKNOWN || b == ADDRESS_UNKNOWN) {
+        return 1;
+    }
+    return (a > b ? a - b : b - a) < WORD_BYTES;
+}
+
+// Open-addressing map from a known address to a small integer
+typedef struct AddressMap {
+    int *keys;
+    int *values;
+    size_t mask;
+} AddressMap;
+
+void initAddressMap(AddressMap *map, int expected);
+int *addressEntry(AddressMap *map, int address);    // Inserts address with value -1 if absent
+int addressValue(const AddressMap *map, int address);  // -1 if absent
+void freeAddressMap(AddressMap *map);
+
+/**
+ * Fills address[i] with the byte address instruction i touches when it is known at compile
+ * time: the address register of a load or store holds a loadI constant, possibly combined
+ * with other constants by arithmetic (plus the offset of loadAI and storeAI), and output
+ * always names its address. Everything else
+ * gets ADDRESS_UNKNOWN. Works on source registers, so it can run before or after renaming.
+ */
+void computeAddresses(const IR *ir, int *address);
+
+/**
+ * Fills next[i], for every load i, with the first later store that may overwrite the word it
+ * read, or INT_MAX if there is none. Entries for other instructions are unspecified.
+ */
+void computeNextClobber(const IR *ir, const int *address, int *next);
+
+#endif
@@ -1,10 +1,16 @@
 #include "allocator.h"
 #include "list.h"
-#include "ir.h"
+#include "IR.h"
 #include "utils.h"
+#include "emit.h"
+#include "alias.h"
+#include "coloring.h"
+#include "linear_scan.h"
+#include "optimal.h"
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 static int spillMemoryBase = 32768;  // Starting address for spilled memory
 
@@ -13,47 +19,75 @@ void initAllocator(Allocator *allocator, IR *ir, int k) {
         printf("Error: IR is NULL\n");
         exit(EXIT_FAILURE);
     }
-    if (ir->instructions == NULL) {
-        printf("Error: IR instructions list is NULL\n");
+    if (k > IR_MAX_PR) {
+        printf("Error: At most %d physical registers are supported\n", IR_MAX_PR);
         exit(EXIT_FAILURE);
     }
     allocator->ir = ir;
     allocator->k = k;
     allocator->live = 0;
+    allocator->maxLive = 0;
     allocator->lastStore = 0;
+    allocator->frameSpills = 0;
+    allocator->frameBaseLoaded = 0;
     allocator->currentInstructionIndex = 0;
     allocator->nextSpillLocation = spillMemoryBase;
-    allocator->maxRegisters = getMaxSR(ir->instructions);
+    allocator->vrCount = 0;
+    allocator->spillCycles = 0;
+    allocator->spillStores = 0;
+    allocator->restores = 0;
+    allocator->cleanReloads = 0;
+    allocator->remats = 0;
+    allocator->searchNodes = OPT_DEFAULT_NODES;
+    allocator->searchMillis = OPT_DEFAULT_MILLIS;
+    allocator->maxRegisters = getMaxSR(ir);
 
     if (allocator->ir->count <= 0) {
         printf("Warning: IR count is zero or uninitialized\n");
     }
 
-    allocator->VRtoPR = (int *)malloc(ir->count * sizeof(int));
-    allocator->VRtoMemory = (int *)malloc(ir->count * sizeof(int));
-    allocator->PRtoVR = (int *)malloc(k * sizeof(int));
-    allocator->freePRs = (int *)malloc(k * sizeof(int));
-    allocator->PRnext = (int *)malloc(k * sizeof(int));
-    allocator->PRsUsed = (int *)malloc(k * sizeof(int));
-    allocator->VRrem = (int *)malloc(ir->count * sizeof(int));
+    // All allocator tables come from one arena and are released together by freeAllocator
+    initArena(&allocator->arena, 0);
+    allocator->VRtoPR = (int *)arenaAlloc(&allocator->arena, ir->count * sizeof(int));
+    allocator->VRtoMemory = (int *)arenaAlloc(&allocator->arena, ir->count * sizeof(int));
+    allocator->PRtoVR = (int *)arenaAlloc(&allocator->arena, k * sizeof(int));
+    allocator->freePRs = (int *)arenaAlloc(&allocator->arena, k * sizeof(int));
+    allocator->PRnext = (int *)arenaAlloc(&allocator->arena, k * sizeof(int));
+    allocator->PRsUsed = (unsigned int *)arenaAlloc(&allocator->arena, k * sizeof(unsigned int));
+    allocator->VRrem = (int *)arenaAlloc(&allocator->arena, ir->count * sizeof(int));
+    allocator->ownsSlot = (char *)arenaAlloc(&allocator->arena, ir->count + 1);
+    allocator->freeSlots = (int *)arenaAlloc(&allocator->arena, (ir->count + 1) * sizeof(int));
+    allocator->freeSlotsCount = 0;
+    allocator->liveCount = (int *)arenaAlloc(&allocator->arena, ir->count * sizeof(int));
+    allocator->address = (int *)arenaAlloc(&allocator->arena, ir->count * sizeof(int));
+    allocator->nextClobber = (int *)arenaAlloc(&allocator->arena, ir->count * sizeof(int));
+    allocator->smallK = (k <= ALLOC_MASK_BITS);
+    allocator->usedGeneration = 1;
+    allocator->usedMask = 0;
+    allocator->occupiedMask = 0;
+    if (!allocator->smallK) {
+        allocator->spillSkipped = (int *)arenaAlloc(&allocator->arena, k * sizeof(int));
+        initIndexedHeap(&allocator->spillHeap, k, &allocator->arena);
+    }
 
     allocator->freePRsCount = k;
 
-    //allocator->finalIR.instructions = (IRLine *)malloc(ir->count * sizeof(IRLine));
-    allocator->finalIR.instructions = emptyList();
-    allocator->finalIR.count = 0;
-    // allocator->finalIR.capacity = ir->count;
+    initIR(&allocator->finalIR);
 
     for (int i = 0; i < ir->count; i++) {
         allocator->VRtoPR[i] = -1;
         allocator->VRtoMemory[i] = -1;
         allocator->VRrem[i] = -1;
+        allocator->ownsSlot[i] = 0;
+        allocator->liveCount[i] = 0;
     }
     for (int i = 1; i < k; i++) { // Start at 1 to skip PR0
         allocator->PRtoVR[i] = -1;       
         allocator->PRnext[i] = -1;       
         allocator->freePRs[i - 1] = i;   
-        allocator->PRsUsed[i] = 0;
+    }
+    for (int i = 0; i < k; i++) {
+        allocator->PRsUsed[i] = 0;       // Below the first generation, so nothing starts in use
     }
     allocator->PRtoVR[0] = -1;           // Explicitly initialize PR0 mapping
     allocator->PRnext[0] = -1;           // Explicitly initialize PR0 next-use
@@ -67,12 +101,12 @@ void computeLastUse(Allocator *allocator) {
     //printf("Starting last use computation...\n");
     //printList(allocator->ir->instructions);
 
-    if (!allocator || !allocator->ir || !allocator->ir->instructions) {
+    if (!allocator || !allocator->ir) {
         printf("Error: Allocator or IR is NULL\n");
         return;
     }
-    List *current = allocator->ir->instructions->tail;
-    int irCount = allocator->ir->count;
+    IR *ir = allocator->ir;
+    int irCount = ir->count;
     int *lastUse = (int *)malloc(allocator->maxRegisters * sizeof(int));
     if (!lastUse) {
         printf("Error: Failed to allocate memory for lastUse array\n");
@@ -83,6 +117,11 @@ void computeLastUse(Allocator *allocator) {
         printf("Error: Failed to allocate memory for SRtoVR array\n");
         exit(EXIT_FAILURE);
     }
+    int *liveEnd = (int *)malloc(allocator->maxRegisters * sizeof(int));  // Last read of each SR's current value
+    if (!liveEnd) {
+        printf("Error: Failed to allocate memory for liveEnd array\n");
+        exit(EXIT_FAILURE);
+    }
     // int SRtoVR[allocator->maxRegisters]; // Map SR to VR
     int currentVR = 0;         // Current virtual register index
     int lastStore = 0;
@@ -92,55 +131,161 @@ void computeLastUse(Allocator *allocator) {
         lastUse[i] = INT_MAX;
         SRtoVR[i] = -1;
     }
-    allocator->live = 0;
-
-    for (int i = irCount - 1; i >= 0 && current; i--) {
-        IRLine *line = current->head;
-        if (!line) {
-            current = current->prev;
-            continue;
-        }
-        if (line->opcode == STORE) {
+    // live tracks how many SRs currently map to a VR; updateOperand raises it when a
+    // mapping is born and a definition lowers it, so no per-instruction rescan is needed
+    int live = 0;
+    int maxLive = 0;
+    computeAddresses(ir, allocator->address);
+    computeNextClobber(ir, allocator->address, allocator->nextClobber);
+
+    for (int i = irCount - 1; i >= 0; i--) {
+        if (isStoreOp(ir->opcode[i])) {
             lastStore = i;
         }
-        updateOperand(&line->dst, i, SRtoVR, lastUse, &currentVR, lastStore);
-        if (line->dst.sr != -1) {
-            SRtoVR[line->dst.sr] = -1;
-            //lastUse[line->dst.sr] = irCount + 1;
-            lastUse[line->dst.sr] = INT_MAX;
+        updateOperand(&ir->dst, i, SRtoVR, lastUse, &currentVR, lastStore, &live);
+        int dstSR = ir->dst.sr[i];
+        if (dstSR != -1) {
+            if (live > maxLive) {
+                maxLive = live;  // The result needs a register too, even if it is never read
+            }
+            if (ir->dst.nu[i] != INT_MAX) {
+                // A loaded value is only clean if no store that may overwrite it comes before its
+                // last read, not just its next one
+                int clobber = isLoadOp(ir->opcode[i]) ? allocator->nextClobber[i] : lastStore;
+                setOperandDirty(&ir->dst, i, liveEnd[dstSR] > clobber);
+            }
+            SRtoVR[dstSR] = -1;  // The definition ends this VR's live range
+            live--;
+            //lastUse[dstSR] = irCount + 1;
+            lastUse[dstSR] = INT_MAX;
+        }
+        if (ir->src1.sr[i] != -1 && SRtoVR[ir->src1.sr[i]] == -1) {
+            liveEnd[ir->src1.sr[i]] = i;
+        }
+        updateOperand(&ir->src1, i, SRtoVR, lastUse, &currentVR, lastStore, &live);
+        if (ir->src2.sr[i] != -1 && SRtoVR[ir->src2.sr[i]] == -1) {
+            liveEnd[ir->src2.sr[i]] = i;
         }
-        updateOperand(&line->src1, i, SRtoVR, lastUse, &currentVR, lastStore);
-        updateOperand(&line->src2, i, SRtoVR, lastUse, &currentVR, lastStore);
+        updateOperand(&ir->src2, i, SRtoVR, lastUse, &currentVR, lastStore, &live);
 
-        allocator->live = countAlive(allocator->maxRegisters, SRtoVR);
-        current = current->prev;
+        allocator->liveCount[i] = live;  // Values live on entry to instruction i
+        if (live > maxLive) {
+            maxLive = live;
+        }
     }
+    allocator->live = live;
+    allocator->maxLive = maxLive;
+    allocator->vrCount = currentVR;
     // printf("CurrentVR: %d\n", currentVR);
+    free(lastUse);
+    free(SRtoVR);
+    free(liveEnd);
 }
 
+void copyLastUse(Allocator *allocator, const Allocator *source) {
+    assertCondition(allocator->ir == source->ir, "Last-use facts belong to another IR");
+    allocator->live = source->live;
+    allocator->maxLive = source->maxLive;
+    allocator->vrCount = source->vrCount;
+    memcpy(allocator->liveCount, source->liveCount, allocator->ir->count * sizeof(int));
+    memcpy(allocator->address, source->address, allocator->ir->count * sizeof(int));
+    memcpy(allocator->nextClobber, source->nextClobber, allocator->ir->count * sizeof(int));
+}
 
-int updateOperand(Operand *op, int idx, int *SRtoVR, int *lastUse, int *currentVR, int lastStore) {
-    if (op->sr != -1) {
-        if (SRtoVR[op->sr] == -1) {
-            SRtoVR[op->sr] = (*currentVR)++;
+
+int updateOperand(OperandColumns *op, int idx, int *SRtoVR, int *lastUse, int *currentVR, int lastStore, int *live) {
+    int sr = op->sr[idx];
+    if (sr != -1) {
+        if (SRtoVR[sr] == -1) {
+            SRtoVR[sr] = (*currentVR)++;
+            (*live)++;
         }
-        op->vr = SRtoVR[op->sr];
-        op->nu = lastUse[op->sr];  // Set next use
-        lastUse[op->sr] = idx;     // Update last use
-        op->dirty = (op->nu > lastStore) ? 1 : 0;
-        return op->vr;
+        op->vr[idx] = SRtoVR[sr];
+        op->nu[idx] = lastUse[sr];  // Set next use
+        lastUse[sr] = idx;          // Update last use
+        setOperandDirty(op, idx, op->nu[idx] > lastStore);
+        return op->vr[idx];
     }
     return -1;
 }
 
-int countAlive(int maxRegisters, int *SRtoVR) {
-    int count = 0;
-    for (int i = 0; i < maxRegisters; i++) {
-        if (SRtoVR[i] != -1) {
-            count++;
+// Spill cost of the value held in a PR: rematerializable < clean < dirty
+static int spillCost(Allocator *allocator, int vr) {
+    if (allocator->VRrem[vr] != -1) {
+        return 1; // Rematerializable
+    } else if (allocator->VRtoMemory[vr] != -1) {
+        return 3; // Respilled / Clean
+    }
+    return 6; // Dirty
+}
+
+// "In use by the current instruction" marks. Small k keeps them as a bit mask; larger k
+// stamps PRsUsed with the current generation, so releasing every mark is a single increment.
+static inline void markPRUsed(Allocator *allocator, int pr) {
+    if (allocator->smallK) {
+        allocator->usedMask |= (uint64_t)1 << pr;
+    } else {
+        allocator->PRsUsed[pr] = allocator->usedGeneration;
+    }
+}
+
+static inline int isPRUsed(Allocator *allocator, int pr) {
+    if (allocator->smallK) {
+        return (allocator->usedMask >> pr) & 1;
+    }
+    return allocator->PRsUsed[pr] == allocator->usedGeneration;
+}
+
+static inline void clearPRsUsed(Allocator *allocator) {
+    allocator->usedMask = 0;
+    allocator->usedGeneration++;
+}
+
+// Records that an occupied PR's VR or next use changed.
+// The spill score is cost - (PRnext - currentInstructionIndex); the instruction index is
+// the same for every candidate, so the heap orders on cost - PRnext alone.
+static void updateSpillScore(Allocator *allocator, int pr) {
+    if (allocator->smallK) {
+        allocator->occupiedMask |= (uint64_t)1 << pr;
+        return;
+    }
+    int cost = spillCost(allocator, allocator->PRtoVR[pr]);
+    heapSet(&allocator->spillHeap, pr, cost - allocator->PRnext[pr]);
+}
+
+// Lowest-scoring occupied PR not used by the current instruction (ties go to the lower PR),
+// or -1 if there is none
+static int selectSpillVictim(Allocator *allocator) {
+    if (allocator->smallK) {
+        // Walk the candidate set in ascending PR order
+        uint64_t candidates = allocator->occupiedMask & ~allocator->usedMask;
+        int bestScore = INT_MAX;
+        int bestPR = -1;
+        while (candidates) {
+            int pr = __builtin_ctzll(candidates);
+            candidates &= candidates - 1;
+            int score = spillCost(allocator, allocator->PRtoVR[pr]) - allocator->PRnext[pr];
+            if (bestPR == -1 || score < bestScore) {
+                bestScore = score;
+                bestPR = pr;
+            }
         }
+        return bestPR;
     }
-    return count;
+
+    // The heap holds every occupied PR, lowest score (then lowest PR) on top;
+    // PRs held by the current instruction are set aside and put back afterwards
+    IndexedHeap *heap = &allocator->spillHeap;
+    int skipped = 0;
+    int bestPR;
+    while ((bestPR = heapPop(heap)) != -1 && isPRUsed(allocator, bestPR)) {
+        allocator->spillSkipped[skipped++] = bestPR;
+    }
+    for (int i = 0; i < skipped; i++) {
+        int pr = allocator->spillSkipped[i];
+        heapSet(heap, pr, heap->key[pr]);
+    }
+    return bestPR;
 }
 
 int GetPR(Allocator *allocator, int vr) {
@@ -153,34 +298,13 @@ int GetPR(Allocator *allocator, int vr) {
         allocator->VRtoPR[vr] = freePR;
         allocator->PRnext[freePR] = INT_MAX; // Set initial next-use to infinity
         debug(1,"Using free PR: %d for VR: %d", freePR, vr);
-        allocator->PRsUsed[freePR-1] = 1;
+        markPRUsed(allocator, freePR);
+        updateSpillScore(allocator, freePR);
         return freePR;
     }
 
     // Case 2: Spill logic
-    int bestScore = INT_MAX;
-    int bestPR = -1;
-
-    for (int pr = 1; pr < allocator->k; pr++) { // Skip PR0
-        if (allocator->PRsUsed[pr-1]) continue;
-        int currentVR = allocator->PRtoVR[pr];
-        int cost = 0;
-
-        if (allocator->VRrem[currentVR] != -1) {
-            cost = 1; // Rematerializable
-        } else if (allocator->VRtoMemory[currentVR] != -1) {
-            cost = 3; // Respilled / Clean
-        } else {
-            cost = 6; // Dirty
-        }
-
-        int score = cost - (allocator->PRnext[pr] - allocator->currentInstructionIndex); // Weighted heuristic
-        debug(1,"PR: %d Score: %d, cost = %d, PRnext: %d", pr, score, cost, allocator->PRnext[pr]);
-        if (score < bestScore) {
-            bestScore = score;
-            bestPR = pr;
-        }
-    }
+    int bestPR = selectSpillVictim(allocator);
 
     if (bestPR == -1) {
         printf("Error: No PR available to spill\n");
@@ -193,15 +317,101 @@ int GetPR(Allocator *allocator, int vr) {
     spillRegister(allocator, spilledVR, bestPR);
     debug(1,"Adding PR%d assigned to VR%d", bestPR, vr);
     // Reassign the spilled PR to the new VR
-    allocator->PRsUsed[bestPR-1] = 1;
+    markPRUsed(allocator, bestPR);
     allocator->PRtoVR[bestPR] = vr;
     allocator->VRtoPR[vr] = bestPR;
     allocator->PRnext[bestPR] = INT_MAX; // Set initial next-use to infinity
+    updateSpillScore(allocator, bestPR);
 
     return bestPR;
 }
 
 
+void assignSpillSlot(Allocator *allocator, int vr) {
+    int slot;
+    if (allocator->freeSlotsCount > 0) {
+        slot = allocator->freeSlots[--allocator->freeSlotsCount];  // Most recently freed, keeps the area dense
+    } else {
+        slot = allocator->nextSpillLocation;
+        allocator->nextSpillLocation += 4;
+    }
+    allocator->VRtoMemory[vr] = slot;
+    allocator->ownsSlot[vr] = 1;
+}
+
+void releaseSpillSlot(Allocator *allocator, int vr) {
+    if (allocator->ownsSlot[vr]) {
+        allocator->freeSlots[allocator->freeSlotsCount++] = allocator->VRtoMemory[vr];
+        allocator->ownsSlot[vr] = 0;
+    }
+}
+
+int spillAreaBytes(Allocator *allocator) {
+    return allocator->nextSpillLocation - spillMemoryBase;
+}
+
+// Loads the base of the spill area into PR0 before the first frame-relative access. PR0 is
+// never handed out while spilling, so one loadI serves the rest of the block.
+static void loadFrameBase(Allocator *allocator) {
+    if (!allocator->frameBaseLoaded) {
+        IRLine loadi = {.opcode = LOADI, .src1 = {.imm = spillMemoryBase}, .dst = {.pr = 0}};
+        addToIR(&allocator->finalIR, loadi);
+        allocator->spillCycles += SPILL_LOADI_CYCLES;
+        allocator->frameBaseLoaded = 1;
+    }
+}
+
+// Appends the code storing pr to the spill slot at address
+static void appendSlotStore(Allocator *allocator, int address, int pr) {
+    if (allocator->frameSpills) {
+        loadFrameBase(allocator);
+        IRLine store = {.opcode = STOREAI, .src1 = {.pr = pr, .imm = address - spillMemoryBase}, .src2 = {.pr = 0}};
+        addToIR(&allocator->finalIR, store);
+    } else {
+        IRLine loadi = {.opcode = LOADI, .src1 = {.imm = address}, .dst = {.pr = 0}};
+        IRLine store = {.opcode = STORE, .src1 = {.pr = pr}, .src2 = {.pr = 0}};
+        addToIR(&allocator->finalIR, loadi);
+        addToIR(&allocator->finalIR, store);
+    }
+    allocator->spillCycles += spillStoreCycles(allocator);
+}
+
+// Cycles of reloading the word at address, a spill slot or the home of a clean value
+static int reloadAddressCycles(const Allocator *allocator, int address) {
+    if (allocator->frameSpills && address >= spillMemoryBase) {
+        return SPILL_MEMORY_CYCLES;
+    }
+    return SPILL_LOADI_CYCLES + SPILL_MEMORY_CYCLES;
+}
+
+// Appends the code loading the word at address into pr
+static void appendReload(Allocator *allocator, int address, int vr, int pr) {
+    if (allocator->frameSpills && address >= spillMemoryBase) {
+        loadFrameBase(allocator);
+        IRLine load = {.opcode = LOADAI, .src1 = {.pr = 0, .imm = address - spillMemoryBase}, .dst = {.pr = pr, .vr = vr}};
+        addToIR(&allocator->finalIR, load);
+    } else {
+        // With a frame base in PR0, a clean value below the spill area is addressed through pr itself
+        int scratch = allocator->frameSpills ? pr : 0;
+        IRLine loadi = {.opcode = LOADI, .src1 = {.imm = address}, .dst = {.pr = scratch}};
+        IRLine load = {.opcode = LOAD, .src1 = {.pr = scratch}, .dst = {.pr = pr, .vr = vr}};
+        addToIR(&allocator->finalIR, loadi);
+        addToIR(&allocator->finalIR, load);
+    }
+    allocator->spillCycles += reloadAddressCycles(allocator, address);
+}
+
+int spillStoreCycles(const Allocator *allocator) {
+    return allocator->frameSpills ? SPILL_MEMORY_CYCLES : SPILL_LOADI_CYCLES + SPILL_MEMORY_CYCLES;
+}
+
+int restoreCycles(const Allocator *allocator, const VRInfo *info) {
+    if (info->cost == SPILL_REMAT) {
+        return SPILL_LOADI_CYCLES;
+    }
+    return reloadAddressCycles(allocator, (info->cost == SPILL_CLEAN) ? info->value : spillMemoryBase);
+}
+
 void spillRegister(Allocator *allocator, int vr, int pr) {
     debug(1,"Spilling PR%d assigned to VR%d", pr, vr);
     //rem and spillopt
@@ -213,6 +423,13 @@ void spillRegister(Allocator *allocator, int vr, int pr) {
         // allocator->freePRs[allocator->freePRsCount++] = pr;
         return; // No need to generate store instructions
     }
+    if (allocator->PRnext[pr] == INT_MAX) {
+        debug(1,"VR%d is never used again, skipping store", vr);
+        allocator->VRtoPR[vr] = -1; // Dead values need no slot
+        allocator->PRtoVR[pr] = -1;
+        allocator->PRnext[pr] = -1;
+        return;
+    }
     if (allocator->VRtoMemory[vr] != -1) {
         debug(1,"VR%d is a respill or is clean, skipping store", vr);
 
@@ -232,27 +449,13 @@ void spillRegister(Allocator *allocator, int vr, int pr) {
     // }
 
     if (allocator->VRtoMemory[vr] == -1) {
-        allocator->VRtoMemory[vr] = allocator->nextSpillLocation;
-        allocator->nextSpillLocation += 4;
+        assignSpillSlot(allocator, vr);
     }
     int memoryLocation = allocator->VRtoMemory[vr];
 
-    IRLine *loadi = (IRLine *)malloc(sizeof(IRLine));
-    IRLine *store = (IRLine *)malloc(sizeof(IRLine));
-
-    *loadi = (IRLine){.opcode = LOADI, .src1 = {.imm = memoryLocation}, .dst = {.pr = 0}};
-    // *store = (IRLine){.opcode = STORE, .src1 = {.pr = 0}, .src2 = {.pr = pr}};
-    *store = (IRLine){.opcode = STORE, .src1 = {.pr = pr}, .src2 = {.pr = 0}};
-
-//    printf("New instructions from spill: \n");
-//     prettyPrintInstruction(loadi);
-//     prettyPrintInstruction(store);
-
-    addToIR(&allocator->finalIR, *loadi);
-    addToIR(&allocator->finalIR, *store);
-
-    free(loadi);
-    free(store);
+    // Spill code is copied straight into finalIR, so build it on the stack
+    appendSlotStore(allocator, memoryLocation, pr);
+    allocator->spillStores++;
 
     // allocator->VRspilled[vr] = 1;
     // allocator->lastStore[vr] = allocator->currentInstructionIndex;
@@ -261,8 +464,6 @@ void spillRegister(Allocator *allocator, int vr, int pr) {
     allocator->PRnext[pr] = -1;
     //allocator->freePRs[allocator->freePRsCount++] = pr;
 
-    allocator->finalIR.count += 2;
-
     // printf("// Spilling VR%d from PR%d to memory location %d\n", vr, pr, memoryLocation);
     // printAllocatorState(allocator, allocator->ir->count, allocator->k);
 
@@ -271,18 +472,18 @@ void spillRegister(Allocator *allocator, int vr, int pr) {
 void restoreRegister(Allocator *allocator, int vr, int pr) {
     if (allocator->VRrem[vr] != -1) {
         debug(1,"VR%d is rematerializable, emitting loadI instruction", vr);
-        IRLine *loadi = (IRLine *)malloc(sizeof(IRLine));
-        *loadi = (IRLine){.opcode = LOADI, .src1 = {.imm = allocator->VRrem[vr]}, .dst = {.pr = pr, .vr = vr}};
-        addToIR(&allocator->finalIR, *loadi);
+        IRLine loadi = {.opcode = LOADI, .src1 = {.imm = allocator->VRrem[vr]}, .dst = {.pr = pr, .vr = vr}};
+        addToIR(&allocator->finalIR, loadi);
+        allocator->spillCycles += SPILL_LOADI_CYCLES;
+        allocator->remats++;
 
         // printf("New instructions from restore: \n");
-        // prettyPrintInstruction(loadi);
-
-        free(loadi);
+        // prettyPrintInstruction(&loadi);
 
         allocator->VRtoPR[vr] = pr; // Update mappings
         allocator->PRtoVR[pr] = vr;
         allocator->PRnext[pr] = INT_MAX-1;
+        updateSpillScore(allocator, pr);
         return;
     }
 
@@ -317,27 +518,23 @@ void restoreRegister(Allocator *allocator, int vr, int pr) {
     }
     
     // Create instructions to load the value back into the register
-    IRLine *loadi = (IRLine *)malloc(sizeof(IRLine));
-    IRLine *load = (IRLine *)malloc(sizeof(IRLine));
-
-    *loadi = (IRLine){.opcode = LOADI, .src1 = {.imm = memoryLocation}, .dst = {.pr = 0}};
-    *load = (IRLine){.opcode = LOAD, .src1 = {.pr = 0}, .dst = {.pr = pr, .vr = vr}};
-    addToIR(&allocator->finalIR, *loadi);
-    addToIR(&allocator->finalIR, *load);
+    appendReload(allocator, memoryLocation, vr, pr);
+    if (allocator->ownsSlot[vr]) {
+        allocator->restores++;
+    } else {
+        allocator->cleanReloads++;  // Its memory location is the address it was loaded from
+    }
 
     // printf("New instructions from restore: \n");
-    // prettyPrintInstructionPRs(loadi);
-    // prettyPrintInstructionPRs(load);
-
-    free(loadi);
-    free(load);
-    allocator->finalIR.count += 2;
+    // prettyPrintInstructionPRs(&loadi);
+    // prettyPrintInstructionPRs(&load);
     
 
     // Update allocator state for the restored VR
     allocator->VRtoPR[vr] = pr;
     allocator->PRtoVR[pr] = vr;
     allocator->PRnext[pr] = INT_MAX-1;
+    updateSpillScore(allocator, pr);
     // allocator->finalIR.count += 2;
 
     // printf("// Restoring VR%d to PR%d from memory location %d with next use at %d\n",
@@ -348,98 +545,68 @@ void restoreRegister(Allocator *allocator, int vr, int pr) {
 
 void allocateRegisters(Allocator *allocator) {
     //printf("Allocating registers\n");
-    //int irCount = allocator->ir->count;
-    List *current = allocator->ir->instructions->next;
-    int index = 0;
+    IR *ir = allocator->ir;
 
-    while (current != NULL) {
+    for (int index = 0; index < ir->count; index++) {
         allocator->currentInstructionIndex = index;
 
-        IRLine *line = current->head;
-
         int currentVRs[3] = {-1, -1, -1}; // src1, src2, dst VRs
-        currentVRs[0] = line->src1.vr;
-        currentVRs[1] = line->src2.vr;
-        currentVRs[2] = line->dst.vr;
-        for (int i = 0; i < allocator->k; i++) {
-            allocator->PRsUsed[i] = 0;
-        }
+        currentVRs[0] = ir->src1.vr[index];
+        currentVRs[1] = ir->src2.vr[index];
+        currentVRs[2] = ir->dst.vr[index];
+        clearPRsUsed(allocator);
         for (int i = 0; i < 3; i++) {
         if (currentVRs[i] != -1) {
                 int pr = allocator->VRtoPR[currentVRs[i]];
                 if (pr != -1) {
-                    allocator->PRsUsed[pr-1] = 1;
+                    markPRUsed(allocator, pr);
                 }
             }
         }
 
         debug(1,"-----------------------------------------------------------------------------------------");
-        debug(1,"Allocating registers for instruction %d: Opcode = %d", index, line->opcode);
-        // printf("// ");
-        // prettyPrintInstruction(line);
-        // printf("// ");
-        // prettyPrintInstructionVRs(line);
+        debug(1,"Allocating registers for instruction %d: Opcode = %d", index, ir->opcode[index]);
         // printAllocatorState(allocator, allocator->ir->count, allocator->k);
 
-        processOperand(allocator, &line->src1);
-        processOperand(allocator, &line->src2);    
+        // The IR stays read-only here, so several allocators can share it
+        IRLine line = getIRLine(ir, index);
+        line.src1.pr = processOperand(allocator, &ir->src1, index);
+        line.src2.pr = processOperand(allocator, &ir->src2, index);
 
         // Unassign registers for VRs no longer in use
-        if (line->src1.vr != -1 && (line->src1.nu == INT_MAX)) {
-            //printf("Freeing PR in allocateRegisters. Src1.nu: %d IRcount + 1: %d\n", line->src1.nu, irCount+1);
-            freePR(allocator, line->src1.vr);
+        if (ir->src1.vr[index] != -1 && (ir->src1.nu[index] == INT_MAX)) {
+            freePR(allocator, ir->src1.vr[index]);
         }
-        if (line->src2.vr != -1 && (line->src2.nu == INT_MAX)) {
-            //printf("Freeing PR in allocateRegisters. Src2.nu: %d IRcount + 1: %d\n", line->src2.nu, irCount+1);
-            freePR(allocator, line->src2.vr);
+        if (ir->src2.vr[index] != -1 && (ir->src2.nu[index] == INT_MAX)) {
+            freePR(allocator, ir->src2.vr[index]);
         }
 
         // add loadi to rem list
-        if (line->opcode == LOADI) {
-            allocator->VRtoMemory[line->dst.vr] = line->src1.imm; 
-            allocator->VRrem[line->dst.vr] = line->src1.imm; 
+        if (ir->opcode[index] == LOADI) {
+            allocator->VRtoMemory[ir->dst.vr[index]] = ir->imm[index]; 
+            allocator->VRrem[ir->dst.vr[index]] = ir->imm[index]; 
         }
-        if (line->opcode == LOAD) {      // Initialize as clean
-            if (!line->dst.dirty) {
+        if (isLoadOp(ir->opcode[index])) {      // Initialize as clean
+            if (!operandDirty(&ir->dst, index)) {
                 // printf("Clean value");
-                allocator->VRtoMemory[line->dst.vr] = allocator->VRrem[line->src1.vr];
+                allocator->VRtoMemory[ir->dst.vr[index]] = allocator->address[index];  // -1 if unknown
             }
         }
  
-        for (int i = 0; i < allocator->k; i++) {
-            allocator->PRsUsed[i] = 0;
-        }
+        clearPRsUsed(allocator);
 
         // Handle destination operand (dst)
-        if (line->dst.vr != -1) {
-            //printf("Processing Dst: VR = %d\n", line->dst.vr);
-            int pr = GetPR(allocator, line->dst.vr);
-            allocator->VRtoPR[line->dst.vr] = pr;
-            allocator->PRtoVR[pr] = line->dst.vr;
-            allocator->PRnext[pr] = line->dst.nu;
-            //printf("Assigned PR%d to VR%d with Next Use: %d\n", pr, line->dst.vr, allocator->PRnext[pr]);
-            line->dst.pr = pr;
+        int dstVR = ir->dst.vr[index];
+        if (dstVR != -1) {
+            int pr = GetPR(allocator, dstVR);
+            allocator->VRtoPR[dstVR] = pr;
+            allocator->PRtoVR[pr] = dstVR;
+            allocator->PRnext[pr] = ir->dst.nu[index];
+            updateSpillScore(allocator, pr);
+            line.dst.pr = pr;
         }
 
-
-
-        // if (line->dst.vr != -1 && (line->dst.nu == INT_MAX)) {
-        //     freePR(allocator, line->dst.vr);
-        // }
-        //printf("Completed instruction %d\n", index);
-        //printf("PRnext after processing instruction %d:\n", index);
-        // for (int pr = 0; pr < allocator->k; pr++) {
-        //     printf("  PR%d -> Next Use: %d\n", pr, allocator->PRnext[pr]);
-        // }
-        
-        // printf("// ");
-        // prettyPrintInstructionPRs(line);
-        addToIR(&allocator->finalIR, *line);
-        // append(allocator->finalIR.instructions, line);
-        // allocator->finalIR.count++;
-
-        current = current->next;
-        index++;
+        addToIR(&allocator->finalIR, line);
         // printf("After allocating registers for instruction %d:\n", index);
         // printAllocatorState(allocator, allocator->ir->count, allocator->k);
 
@@ -447,79 +614,196 @@ void allocateRegisters(Allocator *allocator) {
     //printf("Finished Allocating registers\n");
 }
 
-void processOperand(Allocator *allocator, Operand *op) {
-    if (op->vr != -1) {
-        if (allocator->VRtoPR[op->vr] == -1) {
-            int pr = GetPR(allocator, op->vr);
-            if (allocator->VRtoMemory[op->vr] != -1) {
-                restoreRegister(allocator, op->vr, pr);
+int processOperand(Allocator *allocator, OperandColumns *op, int index) {
+    int vr = op->vr[index];
+    if (vr != -1) {
+        if (allocator->VRtoPR[vr] == -1) {
+            int pr = GetPR(allocator, vr);
+            if (allocator->VRtoMemory[vr] != -1) {
+                restoreRegister(allocator, vr, pr);
+            }
+            allocator->VRtoPR[vr] = pr;
+            allocator->PRtoVR[pr] = vr;
+        }
+        allocator->PRnext[allocator->VRtoPR[vr]] = op->nu[index];
+        updateSpillScore(allocator, allocator->VRtoPR[vr]);
+        return allocator->VRtoPR[vr];
+    }
+    return op->pr[index];
+}
+
+
+void allocateRegistersNoSpill(Allocator *allocator) {
+    IR *ir = allocator->ir;
+    int k = allocator->k;
+
+    // Every PR, PR0 included, starts free
+    for (int pr = 0; pr < k; pr++) {
+        allocator->freePRs[pr] = k - 1 - pr;
+        allocator->PRtoVR[pr] = -1;
+    }
+    allocator->freePRsCount = k;
+
+    for (int index = 0; index < ir->count; index++) {
+        IRLine line = getIRLine(ir, index);
+        Operand *refs[2] = {&line.src1, &line.src2};
+        OperandColumns *srcs[2] = {&ir->src1, &ir->src2};
+        for (int j = 0; j < 2; j++) {
+            int vr = srcs[j]->vr[index];
+            if (vr == -1) {
+                continue;
+            }
+            if (allocator->VRtoPR[vr] == -1) {
+                allocator->VRtoPR[vr] = allocator->freePRs[--allocator->freePRsCount];  // Live on entry
+            }
+            refs[j]->pr = allocator->VRtoPR[vr];
+        }
+        for (int j = 0; j < 2; j++) {
+            int vr = srcs[j]->vr[index];
+            if (vr != -1 && srcs[j]->nu[index] == INT_MAX && allocator->VRtoPR[vr] != -1) {
+                allocator->freePRs[allocator->freePRsCount++] = allocator->VRtoPR[vr];
+                allocator->VRtoPR[vr] = -1;
+            }
+        }
+
+        int dstVR = ir->dst.vr[index];
+        if (dstVR != -1) {
+            int pr = allocator->freePRs[--allocator->freePRsCount];
+            line.dst.pr = pr;
+            if (ir->dst.nu[index] == INT_MAX) {
+                allocator->freePRs[allocator->freePRsCount++] = pr;  // Never read
+            } else {
+                allocator->VRtoPR[dstVR] = pr;
+            }
+        }
+
+        addToIR(&allocator->finalIR, line);
+    }
+}
+
+void runAllocator(Allocator *allocator, AllocMode mode) {
+    if (allocator->maxLive <= allocator->k) {
+        debug(1, "MAXLIVE %d fits in %d registers, renaming without spill code", allocator->maxLive, allocator->k);
+        allocateRegistersNoSpill(allocator);
+        return;
+    }
+    switch (mode) {
+        case ALLOC_COLOR:
+            allocateRegistersColor(allocator);
+            break;
+        case ALLOC_LINEAR:
+            allocateRegistersLinear(allocator);
+            break;
+        case ALLOC_OPTIMAL:
+            allocateRegistersOptimal(allocator, (SearchBudget){allocator->searchNodes, allocator->searchMillis});
+            break;
+        default:
+            allocateRegisters(allocator);
+            break;
+    }
+    debug(1, "Spill code costs %d cycles", allocator->spillCycles);
+    debug(1, "Peak spill area is %d bytes", spillAreaBytes(allocator));
+}
+
+VRInfo *computeVRInfo(Allocator *allocator) {
+    IR *ir = allocator->ir;
+    int vrCount = allocator->vrCount;
+    VRInfo *info = (VRInfo *)arenaAlloc(&allocator->arena, (vrCount > 0 ? vrCount : 1) * sizeof(VRInfo));
+
+    for (int v = 0; v < vrCount; v++) {
+        info[v] = (VRInfo){.def = -1, .lastUse = -1, .uses = 0, .cost = SPILL_DIRTY, .value = 0};
+    }
+    for (int i = 0; i < ir->count; i++) {
+        int srcs[2] = {ir->src1.vr[i], ir->src2.vr[i]};
+        for (int j = 0; j < 2; j++) {
+            if (srcs[j] != -1) {
+                info[srcs[j]].lastUse = i;
+                info[srcs[j]].uses++;
+            }
+        }
+        int dst = ir->dst.vr[i];
+        if (dst != -1) {
+            info[dst].def = i;
+        }
+    }
+
+    for (int i = 0; i < ir->count; i++) {
+        int dst = ir->dst.vr[i];
+        if (dst == -1) {
+            continue;
+        }
+        if (ir->opcode[i] == LOADI) {
+            info[dst].cost = SPILL_REMAT;
+            info[dst].value = ir->imm[i];
+        } else if (isLoadOp(ir->opcode[i]) && allocator->address[i] != ADDRESS_UNKNOWN) {
+            // Clean only if no store that may overwrite the address lands before the value's last use
+            int end = info[dst].lastUse > i ? info[dst].lastUse : i + 1;
+            if (allocator->nextClobber[i] >= end) {
+                info[dst].cost = SPILL_CLEAN;
+                info[dst].value = allocator->address[i];
             }
-            allocator->VRtoPR[op->vr] = pr;
-            allocator->PRtoVR[pr] = op->vr;
         }
-        allocator->PRnext[allocator->VRtoPR[op->vr]] = op->nu;
-        op->pr = allocator->VRtoPR[op->vr];
     }
+
+    return info;
+}
+
+void emitSpillStore(Allocator *allocator, int vr, int pr) {
+    if (allocator->VRtoMemory[vr] == -1) {
+        assignSpillSlot(allocator, vr);
+    }
+    appendSlotStore(allocator, allocator->VRtoMemory[vr], pr);
+    allocator->spillStores++;
 }
 
+void emitRestore(Allocator *allocator, const VRInfo *info, int vr, int pr) {
+    if (info[vr].cost == SPILL_REMAT) {
+        IRLine loadi = {.opcode = LOADI, .src1 = {.imm = info[vr].value}, .dst = {.pr = pr}};
+        addToIR(&allocator->finalIR, loadi);
+        allocator->spillCycles += SPILL_LOADI_CYCLES;
+        allocator->remats++;
+        return;
+    }
+
+    int address = (info[vr].cost == SPILL_CLEAN) ? info[vr].value : allocator->VRtoMemory[vr];
+    if (address == -1) {
+        printf("Error: No memory location assigned for VR%d\n", vr);
+        exit(1);
+    }
+    appendReload(allocator, address, vr, pr);
+    if (info[vr].cost == SPILL_CLEAN) {
+        allocator->cleanReloads++;
+    } else {
+        allocator->restores++;
+    }
+}
 
 void freePR(Allocator *allocator, int vr) {
     //printf("Freeing PR for VR%d\n", vr);
     debug(1, "Freeing PR for VR%d", vr);
     int pr = allocator->VRtoPR[vr];
+    releaseSpillSlot(allocator, vr);  // Only called once the VR is dead
     if (pr != -1) {
         allocator->freePRs[allocator->freePRsCount++] = pr;
         allocator->VRtoPR[vr] = -1;
         allocator->PRtoVR[pr] = -1;
         allocator->PRnext[pr] = -1;
+        if (allocator->smallK) {
+            allocator->occupiedMask &= ~((uint64_t)1 << pr);
+        } else {
+            heapRemove(&allocator->spillHeap, pr);
+        }
         //printf("Freed PR%d assigned to VR%d\n", pr, vr);
     }
 }
 
+void freeAllocator(Allocator *allocator) {
+    freeIR(&allocator->finalIR);
+    freeArena(&allocator->arena);  // Releases every allocator table at once
+}
+
 void printAllocatedIR(Allocator *allocator) {
-    //printf("Printing %d allocated instructions.\n", allocator->finalIR.count);
-
-    List *current = allocator->finalIR.instructions->next;  // Skip sentinel node
-
-    while (current != NULL) {
-        IRLine *line = current->head;
-
-        switch (line->opcode) {
-            case LOADI:
-                printf("loadI %d => r%d\n", line->src1.imm, line->dst.pr);
-                break;
-            case LOAD:
-                printf("load r%d => r%d\n", line->src1.pr, line->dst.pr);
-                break;
-            case STORE:
-                printf("store r%d => r%d\n", line->src1.pr, line->src2.pr);
-                break;
-            case ADD:
-                printf("add r%d, r%d => r%d\n", line->src1.pr, line->src2.pr, line->dst.pr);
-                break;
-            case SUB:
-                printf("sub r%d, r%d => r%d\n", line->src1.pr, line->src2.pr, line->dst.pr);
-                break;
-            case RSHIFT:
-                printf("rshift r%d, r%d => r%d\n", line->src1.pr, line->src2.pr, line->dst.pr);
-                break;
-            case LSHIFT:
-                printf("lshift r%d, r%d => r%d\n", line->src1.pr, line->src2.pr, line->dst.pr);
-                break;
-            case MULT:
-                printf("mult r%d, r%d => r%d\n", line->src1.pr, line->src2.pr, line->dst.pr);
-                break;
-            case OUTPUT:
-                printf("output %d\n", line->src1.imm);
-                break;
-            case NOP:
-                printf("nop");
-                break;
-            default:
-                printf("// Unknown instruction\n");
-        }
-        current = current->next;
-    }
+    emitIR(&allocator->finalIR, EMIT_PR, stdout, 1);
 }
 
 void printAllocatorState(Allocator *allocator, int vrCount) {
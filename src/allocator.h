@@ -1,10 +1,42 @@
 #ifndef ALLOCATOR_H
 #define ALLOCATOR_H
 
-#include "ir.h"  // Assuming this file defines the IR and IRLine structures
+#include "IR.h"  // Assuming this file defines the IR and IRLine structures
+#include "heap.h"
+#include <stdint.h>
+
+#define ALLOC_MASK_BITS 64  // Up to this many PRs, PR sets are kept as 64-bit masks
 
 // #define MAX_REGISTERS 1999999  // Adjust as needed
 
+// Cycle counts charged to the spill code an allocator inserts
+#define SPILL_LOADI_CYCLES 1
+#define SPILL_MEMORY_CYCLES 3
+
+// Register allocation strategies selectable with --alloc
+typedef enum {
+    ALLOC_LOCAL,    // Bottom-up local allocator (default)
+    ALLOC_COLOR,    // Chaitin-Briggs graph coloring
+    ALLOC_LINEAR,   // Poletto/Sarkar linear scan
+    ALLOC_OPTIMAL   // Exact branch-and-bound search within a budget
+} AllocMode;
+
+// Cost of spilling a value, by how it can be brought back (the scores GetPR uses)
+typedef enum {
+    SPILL_REMAT = 1,    // Defined by loadI: rematerialize with another loadI
+    SPILL_CLEAN = 3,    // Loaded from a constant address that no store touches while it is live
+    SPILL_DIRTY = 6     // Needs a store to a spill slot
+} SpillCost;
+
+// Whole-block facts about one virtual register
+typedef struct VRInfo {
+    int def;        // Defining instruction, or -1 if the value is live on entry
+    int lastUse;    // Last instruction reading it, or -1 if it is never read
+    int uses;       // Number of operand slots reading it
+    SpillCost cost; // How it can be spilled
+    int value;      // loadI constant (SPILL_REMAT) or memory address (SPILL_CLEAN)
+} VRInfo;
+
 // Allocator structure
 typedef struct Allocator {
     IR *ir;
@@ -15,15 +47,39 @@ typedef struct Allocator {
     int *PRtoVR;
     int *PRnext;
     int *freePRs;
-    int *PRsUsed;
+    unsigned int *PRsUsed;   // Generation stamp of the last instruction that used each PR
     int *VRrem;
     int *lastLoaded;
+    int *liveCount;  // Number of values live on entry to each instruction
+    int *address;    // Known address of each memory instruction, or ADDRESS_UNKNOWN
+    int *nextClobber; // For each load, the first later store that may overwrite its address
+    int *spillSkipped;       // Scratch for PRs set aside while picking a spill victim
+    IndexedHeap spillHeap;   // Occupied PRs keyed on spill score (k > ALLOC_MASK_BITS)
+    unsigned int usedGeneration;  // PRsUsed entries equal to this are in use
+    uint64_t usedMask;       // PRs in use by the current instruction (k <= ALLOC_MASK_BITS)
+    uint64_t occupiedMask;   // PRs holding a VR (k <= ALLOC_MASK_BITS)
+    int smallK;              // Whether the mask path is active
     int freePRsCount;
-    int nextSpillLocation;
+    int nextSpillLocation;   // End of the spill area; slots are reused, so this marks its peak
+    char *ownsSlot;          // Whether VRtoMemory of each VR is a spill slot it owns
+    int *freeSlots;          // Spill slots released by dead VRs
+    int freeSlotsCount;
+    int vrCount;     // Number of VRs computeLastUse assigned
+    int spillCycles; // Cycles spent in inserted spill and restore code
+    int spillStores; // Values stored to a spill slot
+    int restores;    // Values reloaded from a spill slot
+    int cleanReloads; // Values reloaded from the address they were loaded from
+    int remats;      // Values rematerialized with loadI
+    long searchNodes;   // Node budget for ALLOC_OPTIMAL
+    long searchMillis;  // Time budget for ALLOC_OPTIMAL
     int k;
-    int live;
+    int live;        // Values live on entry to the block
+    int maxLive;     // MAXLIVE: most values needing a register at once, counting each def
     int lastStore;
+    int frameSpills;     // Address spill slots from PR0 with loadAI/storeAI (--frame)
+    int frameBaseLoaded; // Whether PR0 already holds the base of the spill area
     int currentInstructionIndex;
+    Arena arena;     // Backing storage for the tables above
 } Allocator;
 
 
@@ -36,18 +92,27 @@ void initAllocator(Allocator *allocator, IR *ir, int k);
 
 /**
  * Computes the last use of each operand and populates the next use table.
+ * Also records the live count at every instruction and MAXLIVE, and the known address of
+ * every memory operation, so loaded values stay clean across stores that cannot alias them.
  */
 void computeLastUse(Allocator *allocator);
 
+/**
+ * Takes over the results of computeLastUse run by source on the same IR, so allocators
+ * for several k can share one pass. The IR itself already carries the VRs and next uses.
+ */
+void copyLastUse(Allocator *allocator, const Allocator *source);
+
 /**
  * Updates the last use and assigns virtual registers for an operand.
- * Used during the last-use computation phase.
+ * Used during the last-use computation phase; *live counts each newly mapped SR.
  */
-int updateOperand(Operand *op, int idx, int *SRtoVR, int *lastUse, int *currentVR, int lastStore);
+int updateOperand(OperandColumns *op, int idx, int *SRtoVR, int *lastUse, int *currentVR, int lastStore, int *live);
 
 /**
  * Allocates physical registers for each instruction in the IR.
  * Includes spilling and restoring of virtual registers as needed.
+ * Only reads the IR; the allocated code goes to finalIR.
  */
 void allocateRegisters(Allocator *allocator);
 
@@ -61,6 +126,21 @@ int GetPR(Allocator *allocator, int vr);
  */
 void spillRegister(Allocator *allocator, int vr, int pr);
 
+/**
+ * Gives vr a spill slot, reusing one released by a dead VR when possible.
+ */
+void assignSpillSlot(Allocator *allocator, int vr);
+
+/**
+ * Returns vr's spill slot to the free list; call once vr is dead.
+ */
+void releaseSpillSlot(Allocator *allocator, int vr);
+
+/**
+ * Returns the peak size of the spill area in bytes.
+ */
+int spillAreaBytes(Allocator *allocator);
+
 /**
  * Restores a virtual register from memory to a physical register.
  */
@@ -71,13 +151,53 @@ void restoreRegister(Allocator *allocator, int vr, int pr);
  */
 void freePR(Allocator *allocator, int vr);
 
+/**
+ * Releases the allocator tables and the final IR.
+ */
+void freeAllocator(Allocator *allocator);
+
+/**
+ * Renames VRs straight onto PR0..PRk-1 with no spill bookkeeping. Only valid when MAXLIVE <= k.
+ */
+void allocateRegistersNoSpill(Allocator *allocator);
+
+/**
+ * Runs the allocator selected by mode; the result is left in finalIR.
+ * Blocks whose MAXLIVE fits in k take the allocateRegistersNoSpill fast path instead.
+ */
+void runAllocator(Allocator *allocator, AllocMode mode);
+
+/**
+ * Computes def, last use, use count and spill cost of every VR. The table lives in the allocator arena.
+ */
+VRInfo *computeVRInfo(Allocator *allocator);
+
+/**
+ * Appends spill code storing vr from pr to its spill slot, assigning the slot on first use.
+ */
+void emitSpillStore(Allocator *allocator, int vr, int pr);
+
+/**
+ * Appends code reloading vr into pr the cheapest way its VRInfo allows.
+ */
+void emitRestore(Allocator *allocator, const VRInfo *info, int vr, int pr);
+
+/**
+ * Cycles emitSpillStore charges for one store.
+ */
+int spillStoreCycles(const Allocator *allocator);
+
+/**
+ * Cycles emitRestore charges for reloading a value described by info.
+ */
+int restoreCycles(const Allocator *allocator, const VRInfo *info);
+
 /**
  * Prints the IR with allocated registers for debugging or verification.
  */
 void printAllocatedIR(Allocator *allocator);
 
-void processOperand(Allocator *allocator, Operand *op);
-int countAlive(int maxRegisters, int *SRtoVR);
+int processOperand(Allocator *allocator, OperandColumns *op, int index);
 // int isCleanValue(Allocator *allocator, int vr, int currentInstruction);
 
 void printAllocatorState(Allocator *allocator, int vrCount);
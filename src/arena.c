@@ -0,0 +1,64 @@
+#include "arena.h"
+#include "utils.h"
+#include <stdlib.h>
+
+#define ARENA_ALIGNMENT 16
+#define ARENA_DEFAULT_BLOCK (64 * 1024)
+
+void initArena(Arena *arena, size_t blockSize) {
+    arena->head = NULL;
+    arena->blockSize = blockSize ? blockSize : ARENA_DEFAULT_BLOCK;
+    arena->allocations = 0;
+    arena->bytes = 0;
+}
+
+void *arenaAlloc(Arena *arena, size_t size) {
+    size = (size + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+
+    ArenaBlock *block = arena->head;
+    if (!block || block->size - block->used < size) {
+        // Oversized requests get a block of their own
+        size_t capacity = (size > arena->blockSize) ? size : arena->blockSize;
+        block = (ArenaBlock *)malloc(sizeof(ArenaBlock) + capacity);
+        assertCondition(block != NULL, "Failed to allocate arena block");
+        block->used = 0;
+        block->size = capacity;
+        block->next = arena->head;
+        arena->head = block;
+    }
+
+    void *result = block->data + block->used;
+    block->used += size;
+    arena->allocations++;
+    arena->bytes += size;
+    return result;
+}
+
+void arenaReset(Arena *arena) {
+    if (!arena->head) {
+        return;
+    }
+    ArenaBlock *keep = arena->head;
+    ArenaBlock *block = keep->next;
+    while (block) {
+        ArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    keep->next = NULL;
+    keep->used = 0;
+    arena->allocations = 0;
+    arena->bytes = 0;
+}
+
+void freeArena(Arena *arena) {
+    ArenaBlock *block = arena->head;
+    while (block) {
+        ArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    arena->head = NULL;
+    arena->allocations = 0;
+    arena->bytes = 0;
+}
@@ -0,0 +1,43 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+// One chunk of arena memory; allocations are bumped out of data
+typedef struct ArenaBlock {
+    struct ArenaBlock *next;  // Previously filled block
+    size_t used;              // Bytes handed out from data
+    size_t size;              // Capacity of data
+    size_t reserved;          // Pads the header so data stays 16-byte aligned
+    char data[];
+} ArenaBlock;
+
+// Bump allocator: many small allocations, released all at once
+typedef struct Arena {
+    ArenaBlock *head;         // Block currently being filled
+    size_t blockSize;         // Default capacity of new blocks
+    size_t allocations;       // Number of arenaAlloc calls served
+    size_t bytes;             // Total bytes handed out
+} Arena;
+
+/**
+ * Initializes an empty arena. Blocks are allocated lazily, blockSize bytes at a time.
+ */
+void initArena(Arena *arena, size_t blockSize);
+
+/**
+ * Returns size bytes of uninitialized, suitably aligned memory owned by the arena.
+ */
+void *arenaAlloc(Arena *arena, size_t size);
+
+/**
+ * Releases every allocation at once, keeping the newest block for reuse.
+ */
+void arenaReset(Arena *arena);
+
+/**
+ * Releases every block owned by the arena.
+ */
+void freeArena(Arena *arena);
+
+#endif
@@ -0,0 +1,299 @@
+#include "coloring.h"
+#include "heap.h"
+#include "utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+
+#define NO_SPILL INT_MAX  // Cost of a range that must get a register
+
+// One node of the interference graph. Instruction i reads its operands at program
+// point 2i and writes its result at 2i+1, so a source that dies at i can share a
+// register with the value i defines.
+typedef struct {
+    int start;      // First program point the value occupies a register
+    int end;        // Last program point the value occupies a register
+    int vr;         // VR the range belongs to
+    int cost;       // Spill cost, or NO_SPILL
+} LiveRange;
+
+// Interference graph of one coloring round, in compressed adjacency form
+typedef struct {
+    LiveRange *ranges;
+    int count;
+    int *vrNode;        // Node holding each unspilled VR, or -1
+    int *slotNode;      // Node of each spilled operand slot (3 per instruction), or -1
+    size_t *first;      // Neighbours of node n are adj[first[n] .. first[n+1])
+    int *adj;
+} Interference;
+
+static int addRange(Interference *graph, int start, int end, int vr, int cost) {
+    graph->ranges[graph->count] = (LiveRange){start, end, vr, cost};
+    return graph->count++;
+}
+
+// Creates the nodes: whole ranges for unspilled VRs, one-point ranges at every def and use of spilled ones
+static void buildRanges(Interference *graph, Allocator *allocator, const VRInfo *info,
+                        const char *spilled, Arena *arena) {
+    IR *ir = allocator->ir;
+    int vrCount = allocator->vrCount;
+    int maxRanges = vrCount + 3 * ir->count;
+
+    graph->ranges = (LiveRange *)arenaAlloc(arena, (maxRanges > 0 ? maxRanges : 1) * sizeof(LiveRange));
+    graph->vrNode = (int *)arenaAlloc(arena, (vrCount > 0 ? vrCount : 1) * sizeof(int));
+    graph->slotNode = (int *)arenaAlloc(arena, (3 * ir->count > 0 ? 3 * ir->count : 1) * sizeof(int));
+    graph->count = 0;
+
+    for (int v = 0; v < vrCount; v++) {
+        graph->vrNode[v] = -1;
+        if (spilled[v] || (info[v].def == -1 && info[v].lastUse == -1)) {
+            continue;
+        }
+        int start = (info[v].def == -1) ? 0 : 2 * info[v].def + 1;
+        int end = (info[v].lastUse > info[v].def) ? 2 * info[v].lastUse : start;
+        int cost = (info[v].def == -1) ? NO_SPILL : (int)info[v].cost * (info[v].uses + 1);
+        graph->vrNode[v] = addRange(graph, start, end, v, cost);
+    }
+
+    for (int i = 0; i < ir->count; i++) {
+        int vrs[3] = {ir->src1.vr[i], ir->src2.vr[i], ir->dst.vr[i]};
+        for (int j = 0; j < 3; j++) {
+            int v = vrs[j];
+            graph->slotNode[3 * i + j] = -1;
+            if (v == -1 || !spilled[v]) {
+                continue;
+            }
+            if (j == 1 && v == vrs[0]) {
+                graph->slotNode[3 * i + 1] = graph->slotNode[3 * i];  // Both sources share one reload
+            } else if (j < 2) {
+                graph->slotNode[3 * i + j] = addRange(graph, 2 * i, 2 * i, v, NO_SPILL);
+            } else if (info[v].cost != SPILL_REMAT) {
+                // A rematerialized value's loadI is dropped, so only other defs need a register
+                graph->slotNode[3 * i + j] = addRange(graph, 2 * i + 1, 2 * i + 1, v, NO_SPILL);
+            }
+        }
+    }
+}
+
+// Ranges of a straight-line block are intervals, so interference is found with one sweep in
+// start order over the ranges still live. Runs twice: once to size the lists, once to fill them.
+static void buildInterference(Interference *graph, int points, Arena *arena) {
+    int n = graph->count;
+    LiveRange *ranges = graph->ranges;
+
+    // Counting sort of the nodes by start point
+    int *bucket = (int *)arenaAlloc(arena, (points + 1) * sizeof(int));
+    int *order = (int *)arenaAlloc(arena, (n > 0 ? n : 1) * sizeof(int));
+    memset(bucket, 0, (points + 1) * sizeof(int));
+    for (int i = 0; i < n; i++) {
+        bucket[ranges[i].start + 1]++;
+    }
+    for (int p = 0; p < points; p++) {
+        bucket[p + 1] += bucket[p];
+    }
+    for (int i = 0; i < n; i++) {
+        order[bucket[ranges[i].start]++] = i;
+    }
+
+    int *active = (int *)arenaAlloc(arena, (n > 0 ? n : 1) * sizeof(int));
+    size_t *degree = (size_t *)arenaAlloc(arena, (n + 1) * sizeof(size_t));
+    size_t *fill = (size_t *)arenaAlloc(arena, (n + 1) * sizeof(size_t));
+    memset(degree, 0, (n + 1) * sizeof(size_t));
+    graph->first = NULL;
+    graph->adj = NULL;
+
+    for (int pass = 0; pass < 2; pass++) {
+        int activeCount = 0;
+        for (int o = 0; o < n; o++) {
+            int node = order[o];
+            int start = ranges[node].start;
+            int kept = 0;
+            for (int a = 0; a < activeCount; a++) {
+                int other = active[a];
+                if (ranges[other].end < start) {
+                    continue;  // Ended before this range began
+                }
+                active[kept++] = other;
+                if (pass == 0) {
+                    degree[node]++;
+                    degree[other]++;
+                } else {
+                    graph->adj[fill[node]++] = other;
+                    graph->adj[fill[other]++] = node;
+                }
+            }
+            active[kept++] = node;
+            activeCount = kept;
+        }
+
+        if (pass == 0) {
+            graph->first = (size_t *)arenaAlloc(arena, (n + 1) * sizeof(size_t));
+            graph->first[0] = 0;
+            for (int i = 0; i < n; i++) {
+                graph->first[i + 1] = graph->first[i] + degree[i];
+                fill[i] = graph->first[i];
+            }
+            graph->adj = (int *)arenaAlloc(arena, (graph->first[n] > 0 ? graph->first[n] : 1) * sizeof(int));
+        }
+    }
+}
+
+// Briggs ordering key: cheap ranges with many neighbours are spilled first
+static int spillPriority(const LiveRange *range, int degree) {
+    if (range->cost == NO_SPILL) {
+        return INT_MAX;
+    }
+    long long key = (long long)range->cost * 256 / (degree > 0 ? degree : 1);
+    return key < INT_MAX ? (int)key : INT_MAX - 1;
+}
+
+// Simplify/select over the graph with K = k-1 colors. Colors land in color[] (0 = none);
+// returns the number of ranges marked for spilling.
+static int colorGraph(Interference *graph, int colors, int *color, char *spilled, Arena *arena) {
+    int n = graph->count;
+    int *degree = (int *)arenaAlloc(arena, (n > 0 ? n : 1) * sizeof(int));
+    char *removed = (char *)arenaAlloc(arena, (n > 0 ? n : 1));
+    int *lowDegree = (int *)arenaAlloc(arena, (n > 0 ? n : 1) * sizeof(int));
+    int *stack = (int *)arenaAlloc(arena, (n > 0 ? n : 1) * sizeof(int));
+    int lowCount = 0;
+    int stackCount = 0;
+    IndexedHeap highDegree;
+    initIndexedHeap(&highDegree, n, arena);
+
+    for (int i = 0; i < n; i++) {
+        degree[i] = (int)(graph->first[i + 1] - graph->first[i]);
+        removed[i] = 0;
+        if (degree[i] < colors) {
+            lowDegree[lowCount++] = i;
+        } else {
+            heapSet(&highDegree, i, spillPriority(&graph->ranges[i], degree[i]));
+        }
+    }
+
+    // Simplify: remove trivially colorable nodes, otherwise push the best spill candidate optimistically
+    while (stackCount < n) {
+        int node = (lowCount > 0) ? lowDegree[--lowCount] : heapPop(&highDegree);
+        removed[node] = 1;
+        stack[stackCount++] = node;
+        for (size_t e = graph->first[node]; e < graph->first[node + 1]; e++) {
+            int other = graph->adj[e];
+            if (removed[other]) {
+                continue;
+            }
+            degree[other]--;
+            if (degree[other] == colors - 1) {
+                heapRemove(&highDegree, other);
+                lowDegree[lowCount++] = other;
+            } else if (heapContains(&highDegree, other)) {
+                heapSet(&highDegree, other, spillPriority(&graph->ranges[other], degree[other]));
+            }
+        }
+    }
+
+    // Select: pop in reverse, giving each node the lowest color its neighbours left free
+    int *seen = (int *)arenaAlloc(arena, (colors + 1) * sizeof(int));
+    memset(seen, -1, (colors + 1) * sizeof(int));
+    int spills = 0;
+    for (int i = 0; i < n; i++) {
+        color[i] = 0;
+    }
+    while (stackCount > 0) {
+        int node = stack[--stackCount];
+        for (size_t e = graph->first[node]; e < graph->first[node + 1]; e++) {
+            seen[color[graph->adj[e]]] = node;
+        }
+        for (int c = 1; c <= colors; c++) {
+            if (seen[c] != node) {
+                color[node] = c;
+                break;
+            }
+        }
+        if (color[node] == 0) {
+            if (graph->ranges[node].cost == NO_SPILL) {
+                printf("Error: %d registers cannot hold the values live at one instruction\n", colors + 1);
+                exit(EXIT_FAILURE);
+            }
+            spilled[graph->ranges[node].vr] = 1;
+            spills++;
+        }
+    }
+    return spills;
+}
+
+// Writes finalIR from a complete coloring, with reloads before uses and stores after defs of spilled VRs
+static void emitColoredBlock(Allocator *allocator, const VRInfo *info, const char *spilled,
+                             const Interference *graph, const int *color) {
+    IR *ir = allocator->ir;
+    for (int i = 0; i < ir->count; i++) {
+        int vrs[3] = {ir->src1.vr[i], ir->src2.vr[i], ir->dst.vr[i]};
+        int prs[3] = {0, 0, 0};
+
+        if (vrs[2] != -1 && spilled[vrs[2]] && info[vrs[2]].cost == SPILL_REMAT) {
+            continue;  // Every use rematerializes the constant instead
+        }
+
+        for (int j = 0; j < 3; j++) {
+            int v = vrs[j];
+            if (v == -1) {
+                continue;
+            }
+            if (!spilled[v]) {
+                prs[j] = color[graph->vrNode[v]];
+                continue;
+            }
+            prs[j] = color[graph->slotNode[3 * i + j]];
+            if (j == 0 || (j == 1 && v != vrs[0])) {
+                emitRestore(allocator, info, v, prs[j]);
+            }
+        }
+
+        IRLine line = getIRLine(ir, i);
+        line.src1.pr = prs[0];
+        line.src2.pr = prs[1];
+        line.dst.pr = prs[2];
+        addToIR(&allocator->finalIR, line);
+
+        for (int j = 0; j < 2; j++) {
+            if (vrs[j] != -1 && info[vrs[j]].lastUse == i) {
+                releaseSpillSlot(allocator, vrs[j]);  // Dead from here on
+            }
+        }
+        // A result that is never read needs neither a store nor a slot
+        if (vrs[2] != -1 && spilled[vrs[2]] && info[vrs[2]].cost == SPILL_DIRTY && info[vrs[2]].lastUse > i) {
+            emitSpillStore(allocator, vrs[2], prs[2]);
+        }
+    }
+}
+
+void allocateRegistersColor(Allocator *allocator) {
+    IR *ir = allocator->ir;
+    int colors = allocator->k - 1;  // PR0 stays reserved for spill addresses
+    if (colors < 2) {
+        printf("Error: Graph coloring needs at least 3 registers\n");
+        exit(EXIT_FAILURE);
+    }
+
+    VRInfo *info = computeVRInfo(allocator);
+    char *spilled = (char *)arenaAlloc(&allocator->arena, allocator->vrCount > 0 ? allocator->vrCount : 1);
+    memset(spilled, 0, allocator->vrCount > 0 ? allocator->vrCount : 1);
+
+    // Every round's graph lives in one arena that is recycled between rounds
+    Arena round;
+    initArena(&round, 0);
+    int points = 2 * ir->count + 2;
+    for (int pass = 1; ; pass++) {
+        arenaReset(&round);
+        Interference graph;
+        buildRanges(&graph, allocator, info, spilled, &round);
+        buildInterference(&graph, points, &round);
+        int *color = (int *)arenaAlloc(&round, (graph.count > 0 ? graph.count : 1) * sizeof(int));
+        int spills = colorGraph(&graph, colors, color, spilled, &round);
+        debug(1, "Coloring round %d: %d ranges, %zu edges, %d spilled", pass, graph.count, graph.first[graph.count] / 2, spills);
+        if (spills == 0) {
+            emitColoredBlock(allocator, info, spilled, &graph, color);
+            break;
+        }
+    }
+    freeArena(&round);
+}
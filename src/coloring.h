@@ -0,0 +1,15 @@
+#ifndef COLORING_H
+#define COLORING_H
+
+#include "allocator.h"
+
+/**
+ * Allocates registers with Chaitin-Briggs optimistic coloring. Each VR's live range from
+ * computeLastUse is a node of the interference graph; ranges that cannot be colored are
+ * spilled by cost (rematerializable, clean or dirty) and split into one-instruction pieces
+ * around each def and use, then the graph is rebuilt until everything fits in PR1..PRk-1.
+ * Requires computeLastUse; the result is left in finalIR.
+ */
+void allocateRegistersColor(Allocator *allocator);
+
+#endif
@@ -0,0 +1,79 @@
+#include "dce.h"
+#include "alias.h"
+#include "opcodes.h"
+#include "scheduler.h"
+#include "utils.h"
+#include <stdlib.h>
+
+int eliminateDeadCode(IR *ir, int *cycles) {
+    int count = ir->count;
+    int registers = getMaxSR(ir);
+    int *address = (int *)malloc((count > 0 ? count : 1) * sizeof(int));
+    char *keep = (char *)malloc(count > 0 ? count : 1);
+    char *needed = (char *)calloc(registers > 0 ? registers : 1, 1);  // Whether each SR's value is read later
+    assertCondition(address != NULL && keep != NULL && needed != NULL, "Failed to allocate dead code tables");
+    // Read epoch at which each known address was last overwritten with nothing reading it since
+    AddressMap overwritten;
+    initAddressMap(&overwritten, count);
+    int readEpoch = 0;  // Bumped by every load from an unknown address, which may read any word
+
+    computeAddresses(ir, address);
+
+    int removed = 0;
+    int deadStores = 0;
+    int saved = 0;
+    for (int i = count - 1; i >= 0; i--) {
+        int op = ir->opcode[i];
+        int dst = ir->dst.sr[i];
+        keep[i] = (dst == -1 || needed[dst]);
+        if (dst != -1) {
+            needed[dst] = 0;
+        }
+        if (isStoreOp(op)) {
+            if (address[i] != ADDRESS_UNKNOWN) {
+                int *mark = addressEntry(&overwritten, address[i]);
+                if (*mark == readEpoch) {
+                    keep[i] = 0;
+                    deadStores++;
+                } else {
+                    *mark = readEpoch;
+                }
+            }
+        } else if (keep[i] && (isLoadOp(op) || op == OUTPUT)) {
+            if (address[i] == ADDRESS_UNKNOWN) {
+                readEpoch++;
+            } else {
+                // The read keeps every store it may overlap
+                for (int a = address[i] - (WORD_BYTES - 1); a <= address[i] + (WORD_BYTES - 1); a++) {
+                    if (addressValue(&overwritten, a) != -1) {
+                        *addressEntry(&overwritten, a) = -1;
+                    }
+                }
+            }
+        }
+        if (!keep[i]) {
+            removed++;
+            saved += getLatency(op);
+            continue;
+        }
+        if (ir->src1.sr[i] != -1) {
+            needed[ir->src1.sr[i]] = 1;
+        }
+        if (ir->src2.sr[i] != -1) {
+            needed[ir->src2.sr[i]] = 1;
+        }
+    }
+
+    compactIR(ir, keep);
+    debug(1, "Dead code elimination removed %d instructions (%d dead stores), saving %d cycles",
+          removed, deadStores, saved);
+    if (cycles) {
+        *cycles = saved;
+    }
+
+    freeAddressMap(&overwritten);
+    free(address);
+    free(keep);
+    free(needed);
+    return removed;
+}
@@ -0,0 +1,16 @@
+#ifndef DCE_H
+#define DCE_H
+
+#include "IR.h"
+
+/**
+ * Dead code elimination over the source registers of a block, in one backward liveness walk.
+ * A store is dead when a later store to the same known address overwrites it before any load
+ * or output that may alias it reads it (see computeAddresses). Any other instruction except
+ * output and nop is dead when nothing live reads its result; registers are dead at the end of
+ * the block, memory is not. Returns the number of instructions removed and, if cycles is not
+ * NULL, stores there the latency they would have cost.
+ */
+int eliminateDeadCode(IR *ir, int *cycles);
+
+#endif
@@ -0,0 +1,260 @@
+#include "emit.h"
+#include "utils.h"
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#define EMIT_BUFFER_BYTES (1 << 20)     // Streaming emitters write out in chunks of about this size
+#define EMIT_MIN_CHUNK_LINES 65536      // Smallest range worth formatting on its own thread
+#define EMIT_BYTES_PER_LINE 24          // Initial guess used to size collecting buffers
+
+// "00" "01" ... "99", so integers are converted two digits at a time
+static const char digitPairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+static char *formatInt(char *p, int value) {
+    unsigned int v = (unsigned int)value;
+    if (value < 0) {
+        *p++ = '-';
+        v = 0u - v;
+    }
+
+    char digits[10];
+    char *d = digits + sizeof(digits);
+    while (v >= 100) {
+        unsigned int pair = (v % 100) * 2;
+        v /= 100;
+        *--d = digitPairs[pair + 1];
+        *--d = digitPairs[pair];
+    }
+    if (v >= 10) {
+        *--d = digitPairs[v * 2 + 1];
+        *--d = digitPairs[v * 2];
+    } else {
+        *--d = (char)('0' + v);
+    }
+
+    size_t length = (size_t)(digits + sizeof(digits) - d);
+    memcpy(p, d, length);
+    return p + length;
+}
+
+#define PUT(p, literal) (memcpy((p), (literal), sizeof(literal) - 1), (p) += sizeof(literal) - 1)
+
+char *formatInstruction(char *p, int opcode, int imm, int r1, int r2, int rd) {
+    switch (opcode) {
+        case LOADI:
+            PUT(p, "loadI ");
+            p = formatInt(p, imm);
+            PUT(p, " => r");
+            p = formatInt(p, rd);
+            break;
+        case LOAD:
+            PUT(p, "load r");
+            p = formatInt(p, r1);
+            PUT(p, " => r");
+            p = formatInt(p, rd);
+            break;
+        case STORE:
+            PUT(p, "store r");
+            p = formatInt(p, r1);
+            PUT(p, " => r");
+            p = formatInt(p, r2);
+            break;
+        case ADD:
+        case SUB:
+        case MULT:
+        case LSHIFT:
+        case RSHIFT:
+            switch (opcode) {
+                case ADD:    PUT(p, "add r");    break;
+                case SUB:    PUT(p, "sub r");    break;
+                case MULT:   PUT(p, "mult r");   break;
+                case LSHIFT: PUT(p, "lshift r"); break;
+                default:     PUT(p, "rshift r"); break;
+            }
+            p = formatInt(p, r1);
+            PUT(p, ", r");
+            p = formatInt(p, r2);
+            PUT(p, " => r");
+            p = formatInt(p, rd);
+            break;
+        case ADDI:
+        case SUBI:
+        case MULTI:
+        case LSHIFTI:
+        case RSHIFTI:
+            switch (opcode) {
+                case ADDI:    PUT(p, "addI r");    break;
+                case SUBI:    PUT(p, "subI r");    break;
+                case MULTI:   PUT(p, "multI r");   break;
+                case LSHIFTI: PUT(p, "lshiftI r"); break;
+                default:      PUT(p, "rshiftI r"); break;
+            }
+            p = formatInt(p, r1);
+            PUT(p, ", ");
+            p = formatInt(p, imm);
+            PUT(p, " => r");
+            p = formatInt(p, rd);
+            break;
+        case LOADAI:
+            PUT(p, "loadAI r");
+            p = formatInt(p, r1);
+            PUT(p, ", ");
+            p = formatInt(p, imm);
+            PUT(p, " => r");
+            p = formatInt(p, rd);
+            break;
+        case STOREAI:
+            PUT(p, "storeAI r");
+            p = formatInt(p, r1);
+            PUT(p, " => r");
+            p = formatInt(p, r2);
+            PUT(p, ", ");
+            p = formatInt(p, imm);
+            break;
+        case OUTPUT:
+            PUT(p, "output ");
+            p = formatInt(p, imm);
+            break;
+        case NOP:
+            PUT(p, "nop");
+            break;
+        default:
+            PUT(p, "// Unknown instruction");
+    }
+    *p++ = '\n';
+    return p;
+}
+
+void initEmitter(Emitter *emitter, FILE *out, size_t capacity) {
+    if (capacity < EMIT_MAX_LINE) {
+        capacity = EMIT_MAX_LINE;
+    }
+    emitter->out = out;
+    emitter->buf = (char *)malloc(capacity);
+    emitter->len = 0;
+    emitter->cap = capacity;
+    assertCondition(emitter->buf != NULL, "Failed to allocate output buffer");
+}
+
+// Makes room for at least extra more bytes, writing out or growing the buffer as needed
+static void reserveEmitter(Emitter *emitter, size_t extra) {
+    if (emitter->len + extra <= emitter->cap) {
+        return;
+    }
+    if (emitter->out) {
+        flushEmitter(emitter);
+        if (extra <= emitter->cap) {
+            return;
+        }
+    }
+    size_t capacity = emitter->cap * 2;
+    while (capacity < emitter->len + extra) {
+        capacity *= 2;
+    }
+    char *buf = (char *)realloc(emitter->buf, capacity);
+    assertCondition(buf != NULL, "Failed to grow output buffer");
+    emitter->buf = buf;
+    emitter->cap = capacity;
+}
+
+void emitBytes(Emitter *emitter, const char *bytes, size_t length) {
+    reserveEmitter(emitter, length);
+    memcpy(emitter->buf + emitter->len, bytes, length);
+    emitter->len += length;
+}
+
+static inline int registerOf(const OperandColumns *op, int i, RegisterForm form) {
+    switch (form) {
+        case EMIT_VR:
+            return op->vr[i];
+        case EMIT_PR:
+            return op->pr[i];
+        default:
+            return op->sr[i];
+    }
+}
+
+void emitInstructions(Emitter *emitter, const IR *ir, int start, int end, RegisterForm form) {
+    for (int i = start; i < end; i++) {
+        reserveEmitter(emitter, EMIT_MAX_LINE);
+        char *p = emitter->buf + emitter->len;
+        p = formatInstruction(p, ir->opcode[i], ir->imm[i],
+                              registerOf(&ir->src1, i, form),
+                              registerOf(&ir->src2, i, form),
+                              registerOf(&ir->dst, i, form));
+        emitter->len = (size_t)(p - emitter->buf);
+    }
+}
+
+void flushEmitter(Emitter *emitter) {
+    if (emitter->out && emitter->len > 0) {
+        if (fwrite(emitter->buf, 1, emitter->len, emitter->out) != emitter->len) {
+            error("Failed to write output");
+        }
+    }
+    emitter->len = 0;
+}
+
+void freeEmitter(Emitter *emitter) {
+    flushEmitter(emitter);
+    free(emitter->buf);
+    emitter->buf = NULL;
+    emitter->cap = 0;
+}
+
+// One contiguous range of instructions and the text formatted from it
+typedef struct {
+    const IR *ir;
+    int start;
+    int end;
+    RegisterForm form;
+    Emitter emitter;
+} EmitChunk;
+
+static void *emitChunk(void *arg) {
+    EmitChunk *chunk = (EmitChunk *)arg;
+    initEmitter(&chunk->emitter, NULL, (size_t)(chunk->end - chunk->start) * EMIT_BYTES_PER_LINE);
+    emitInstructions(&chunk->emitter, chunk->ir, chunk->start, chunk->end, chunk->form);
+    return NULL;
+}
+
+void emitIR(const IR *ir, RegisterForm form, FILE *out, int threads) {
+    if (threads > ir->count / EMIT_MIN_CHUNK_LINES) {
+        threads = ir->count / EMIT_MIN_CHUNK_LINES;
+    }
+    if (threads <= 1) {
+        Emitter emitter;
+        initEmitter(&emitter, out, EMIT_BUFFER_BYTES);
+        emitInstructions(&emitter, ir, 0, ir->count, form);
+        freeEmitter(&emitter);
+        return;
+    }
+
+    EmitChunk *chunks = (EmitChunk *)malloc(threads * sizeof(EmitChunk));
+    pthread_t *workers = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    assertCondition(chunks != NULL && workers != NULL, "Failed to allocate emitter chunks");
+
+    for (int i = 0; i < threads; i++) {
+        chunks[i].ir = ir;
+        chunks[i].start = (int)((long long)ir->count * i / threads);
+        chunks[i].end = (int)((long long)ir->count * (i + 1) / threads);
+        chunks[i].form = form;
+        if (pthread_create(&workers[i], NULL, emitChunk, &chunks[i]) != 0) {
+            error("Failed to start emitter thread");
+        }
+    }
+
+    // Write each range as soon as it is ready, in order
+    for (int i = 0; i < threads; i++) {
+        pthread_join(workers[i], NULL);
+        chunks[i].emitter.out = out;
+        freeEmitter(&chunks[i].emitter);
+    }
+
+    free(workers);
+    free(chunks);
+}
@@ -0,0 +1,44 @@
+#ifndef EMIT_H
+#define EMIT_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include "IR.h"
+
+// Which register column an instruction is printed with
+typedef enum {
+    EMIT_SR,    // Source registers, as written in the input
+    EMIT_VR,    // Virtual registers after renaming
+    EMIT_PR     // Physical registers after allocation
+} RegisterForm;
+
+#define EMIT_MAX_LINE 96  // Longest line formatInstruction can produce, with room to spare
+
+// Growable output buffer. With a stream attached it is written out whenever it fills up;
+// without one it just collects everything for the caller.
+typedef struct Emitter {
+    FILE *out;      // Destination stream, or NULL to collect only
+    char *buf;      // Formatted bytes not yet written
+    size_t len;     // Bytes used in buf
+    size_t cap;     // Capacity of buf
+} Emitter;
+
+void initEmitter(Emitter *emitter, FILE *out, size_t capacity);
+void emitBytes(Emitter *emitter, const char *bytes, size_t length);
+void emitInstructions(Emitter *emitter, const IR *ir, int start, int end, RegisterForm form);
+void flushEmitter(Emitter *emitter);
+void freeEmitter(Emitter *emitter);
+
+/**
+ * Formats one instruction as a line of ILOC into p, which must have room for EMIT_MAX_LINE bytes.
+ * Returns the position just past the newline.
+ */
+char *formatInstruction(char *p, int opcode, int imm, int r1, int r2, int rd);
+
+/**
+ * Writes every instruction of ir to out. With threads > 1, large blocks are split into
+ * contiguous ranges that are formatted concurrently and written back in order.
+ */
+void emitIR(const IR *ir, RegisterForm form, FILE *out, int threads);
+
+#endif
@@ -0,0 +1,134 @@
+#include "fold.h"
+#include "opcodes.h"
+#include "utils.h"
+#include <limits.h>
+#include <stdlib.h>
+
+int evaluateConstant(int op, long long a, long long b, int *result) {
+    long long value;
+    switch (op) {
+        case ADD:
+            value = a + b;
+            break;
+        case SUB:
+            value = a - b;
+            break;
+        case MULT:
+            value = a * b;
+            break;
+        case LSHIFT:
+            if (b > 31) {
+                return 0;
+            }
+            value = a << b;
+            break;
+        case RSHIFT:
+            if (b > 31) {
+                return 0;
+            }
+            value = a >> b;
+            break;
+        default:
+            return 0;
+    }
+    if (value < 0 || value > INT_MAX) {
+        return 0;
+    }
+    *result = (int)value;
+    return 1;
+}
+
+void initConstantTable(ConstantTable *table, const IR *ir) {
+    int registers = getMaxSR(ir);
+    table->known = (char *)calloc(registers > 0 ? registers : 1, 1);
+    table->value = (int *)malloc((registers > 0 ? registers : 1) * sizeof(int));
+    assertCondition(table->known != NULL && table->value != NULL, "Failed to allocate constant tables");
+}
+
+void freeConstantTable(ConstantTable *table) {
+    free(table->known);
+    free(table->value);
+}
+
+int constantResult(const ConstantTable *table, const IR *ir, int i, int *result) {
+    int op = ir->opcode[i];
+    int src1 = ir->src1.sr[i];
+    int src2 = ir->src2.sr[i];
+    if (op == LOADI) {
+        *result = ir->imm[i];
+        return 1;
+    }
+    if (isImmediateOp(op)) {
+        return table->known[src1] && evaluateConstant(registerForm(op), table->value[src1], ir->imm[i], result);
+    }
+    return op >= ADD && op <= RSHIFT && table->known[src1] && table->known[src2] &&
+           evaluateConstant(op, table->value[src1], table->value[src2], result);
+}
+
+void defineConstant(ConstantTable *table, const IR *ir, int i) {
+    int dst = ir->dst.sr[i];
+    if (dst == -1) {
+        return;  // store, output and nop define nothing
+    }
+    int result;
+    if (constantResult(table, ir, i, &result)) {
+        table->known[dst] = 1;
+        table->value[dst] = result;
+    } else {
+        table->known[dst] = 0;
+    }
+}
+
+int foldConstants(IR *ir) {
+    ConstantTable constants;
+    initConstantTable(&constants, ir);
+
+    // Forward: propagate constants and fold
+    int folded = 0;
+    for (int i = 0; i < ir->count; i++) {
+        int result;
+        if (ir->opcode[i] != LOADI && ir->dst.sr[i] != -1 && constantResult(&constants, ir, i, &result)) {
+            ir->opcode[i] = LOADI;
+            ir->imm[i] = result;
+            ir->src1.sr[i] = -1;
+            ir->src2.sr[i] = -1;
+            folded++;
+        }
+        defineConstant(&constants, ir, i);
+    }
+
+    // Drop loadIs whose value is never read, such as the operands of a folded chain
+    int dropped = dropUnreadConstants(ir);
+    debug(1, "Folded %d instructions into loadI, dropped %d unread loadIs", folded, dropped);
+
+    freeConstantTable(&constants);
+    return folded;
+}
+
+int dropUnreadConstants(IR *ir) {
+    int registers = getMaxSR(ir);
+    char *needed = (char *)calloc(registers > 0 ? registers : 1, 1);  // Whether each SR is read before it is next defined
+    char *keep = (char *)malloc(ir->count > 0 ? ir->count : 1);
+    assertCondition(needed != NULL && keep != NULL, "Failed to allocate constant tables");
+    for (int i = ir->count - 1; i >= 0; i--) {
+        keep[i] = 1;
+        int dst = ir->dst.sr[i];
+        if (dst != -1) {
+            if (ir->opcode[i] == LOADI && !needed[dst]) {
+                keep[i] = 0;
+                continue;
+            }
+            needed[dst] = 0;
+        }
+        if (ir->src1.sr[i] != -1) {
+            needed[ir->src1.sr[i]] = 1;
+        }
+        if (ir->src2.sr[i] != -1) {
+            needed[ir->src2.sr[i]] = 1;
+        }
+    }
+    int dropped = compactIR(ir, keep);
+    free(needed);
+    free(keep);
+    return dropped;
+}
@@ -0,0 +1,46 @@
+#ifndef FOLD_H
+#define FOLD_H
+
+#include "IR.h"
+
+// Which SRs hold a known constant at the current point of a forward walk over a block
+typedef struct ConstantTable {
+    char *known;
+    int *value;   // Valid only where known is set
+} ConstantTable;
+
+void initConstantTable(ConstantTable *table, const IR *ir);
+void freeConstantTable(ConstantTable *table);
+
+/**
+ * Sets *result to the constant instruction i computes from the constants known before it: a
+ * loadI, or an arithmetic op whose register sources are all known. Returns 0 otherwise.
+ */
+int constantResult(const ConstantTable *table, const IR *ir, int i, int *result);
+
+// Records the definition made by instruction i; call after reading its sources
+void defineConstant(ConstantTable *table, const IR *ir, int i);
+
+/**
+ * Constant propagation and folding over the source registers of a freshly parsed block.
+ * Rewrites every add, sub, mult, lshift and rshift, or immediate form of one, whose register
+ * sources all hold known constants as a single loadI of the result, so the allocator can
+ * rematerialize it instead of spilling it. loadIs left without a reader are dropped. Results
+ * that would overflow, go negative or shift by 32 or more are left alone, since a loadI could
+ * not reproduce them. Returns the number of instructions folded.
+ */
+int foldConstants(IR *ir);
+
+/**
+ * Evaluates an add, sub, mult, lshift or rshift on two constants. Returns 0 if the result
+ * cannot be written as a loadI constant (see foldConstants).
+ */
+int evaluateConstant(int op, long long a, long long b, int *result);
+
+/**
+ * Drops every loadI whose value is never read before its SR is redefined or the block ends.
+ * Returns the number of instructions removed.
+ */
+int dropUnreadConstants(IR *ir);
+
+#endif
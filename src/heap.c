@@ -0,0 +1,112 @@
+#include "heap.h"
+#include "utils.h"
+#include <stdlib.h>
+
+static void *heapAlloc(Arena *arena, size_t size) {
+    void *memory = arena ? arenaAlloc(arena, size) : malloc(size);
+    assertCondition(memory != NULL, "Failed to allocate heap");
+    return memory;
+}
+
+void initIndexedHeap(IndexedHeap *heap, int capacity, Arena *arena) {
+    size_t bytes = (capacity > 0 ? capacity : 1) * sizeof(int);
+    heap->heap = (int *)heapAlloc(arena, bytes);
+    heap->pos = (int *)heapAlloc(arena, bytes);
+    heap->key = (int *)heapAlloc(arena, bytes);
+    heap->size = 0;
+    heap->capacity = capacity;
+    for (int i = 0; i < capacity; i++) {
+        heap->pos[i] = -1;
+    }
+}
+
+// Ties on key go to the smaller id
+static inline int heapLess(const IndexedHeap *heap, int a, int b) {
+    return heap->key[a] < heap->key[b] || (heap->key[a] == heap->key[b] && a < b);
+}
+
+static inline void heapPlace(IndexedHeap *heap, int slot, int id) {
+    heap->heap[slot] = id;
+    heap->pos[id] = slot;
+}
+
+static void siftUp(IndexedHeap *heap, int slot) {
+    int id = heap->heap[slot];
+    while (slot > 0) {
+        int parent = (slot - 1) / 2;
+        if (!heapLess(heap, id, heap->heap[parent])) {
+            break;
+        }
+        heapPlace(heap, slot, heap->heap[parent]);
+        slot = parent;
+    }
+    heapPlace(heap, slot, id);
+}
+
+static void siftDown(IndexedHeap *heap, int slot) {
+    int id = heap->heap[slot];
+    for (;;) {
+        int child = slot * 2 + 1;
+        if (child >= heap->size) {
+            break;
+        }
+        if (child + 1 < heap->size && heapLess(heap, heap->heap[child + 1], heap->heap[child])) {
+            child++;
+        }
+        if (!heapLess(heap, heap->heap[child], id)) {
+            break;
+        }
+        heapPlace(heap, slot, heap->heap[child]);
+        slot = child;
+    }
+    heapPlace(heap, slot, id);
+}
+
+void heapSet(IndexedHeap *heap, int id, int key) {
+    int slot = heap->pos[id];
+    if (slot == -1) {
+        heap->key[id] = key;
+        heapPlace(heap, heap->size++, id);
+        siftUp(heap, heap->size - 1);
+        return;
+    }
+    int old = heap->key[id];
+    heap->key[id] = key;
+    if (key < old) {
+        siftUp(heap, slot);
+    } else if (key > old) {
+        siftDown(heap, slot);
+    }
+}
+
+void heapRemove(IndexedHeap *heap, int id) {
+    int slot = heap->pos[id];
+    if (slot == -1) {
+        return;
+    }
+    heap->pos[id] = -1;
+    int last = heap->heap[--heap->size];
+    if (slot == heap->size) {
+        return;
+    }
+    heapPlace(heap, slot, last);
+    siftUp(heap, slot);
+    siftDown(heap, heap->pos[last]);
+}
+
+int heapPop(IndexedHeap *heap) {
+    if (heap->size == 0) {
+        return -1;
+    }
+    int top = heap->heap[0];
+    heapRemove(heap, top);
+    return top;
+}
+
+void freeIndexedHeap(IndexedHeap *heap) {
+    free(heap->heap);
+    free(heap->pos);
+    free(heap->key);
+    heap->heap = heap->pos = heap->key = NULL;
+    heap->size = heap->capacity = 0;
+}
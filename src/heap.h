@@ -0,0 +1,45 @@
+#ifndef HEAP_H
+#define HEAP_H
+
+#include "arena.h"
+
+// Binary min-heap over the ids 0..capacity-1 with a position index, so any id's key can be
+// changed or removed in O(log n). Entries are ordered by key, then by id.
+typedef struct IndexedHeap {
+    int *heap;      // Ids in heap order
+    int *pos;       // Slot of each id in heap, or -1 when absent
+    int *key;       // Current key of each id
+    int size;       // Number of ids in the heap
+    int capacity;   // Largest id + 1
+} IndexedHeap;
+
+/**
+ * Initializes an empty heap for ids below capacity. Storage comes from arena (NULL = malloc).
+ */
+void initIndexedHeap(IndexedHeap *heap, int capacity, Arena *arena);
+
+/**
+ * Inserts id with the given key, or moves it if it is already present.
+ */
+void heapSet(IndexedHeap *heap, int id, int key);
+
+/**
+ * Removes id if it is present.
+ */
+void heapRemove(IndexedHeap *heap, int id);
+
+/**
+ * Removes and returns the id with the smallest key, or -1 when the heap is empty.
+ */
+int heapPop(IndexedHeap *heap);
+
+/**
+ * Releases a heap whose storage came from malloc.
+ */
+void freeIndexedHeap(IndexedHeap *heap);
+
+static inline int heapContains(const IndexedHeap *heap, int id) {
+    return heap->pos[id] != -1;
+}
+
+#endif
@@ -1,26 +1,130 @@
 #include "lexer.h"
 #include "utils.h"
+#include "scan.h"
 #include <ctype.h>
 #include <stdlib.h>
+#include <sys/stat.h>
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
+// Returns the next input byte, either from the in-memory buffer or from the stream
+static inline int nextChar(Lexer *lexer) {
+    if (lexer->cursor) {
+        return (lexer->cursor < lexer->end) ? (unsigned char)*lexer->cursor++ : EOF;
+    }
+    return fgetc(lexer->input);
+}
+
+// Loads a regular file into memory so the scanner can run over a plain cursor.
+// Leaves the lexer in stream mode if the file cannot be mapped or read.
+static void loadInput(Lexer *lexer, FILE *input, size_t length) {
+    long offset = ftell(input);
+    if (offset < 0 || (size_t)offset >= length) {
+        return;
+    }
+#ifndef _WIN32
+    void *data = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fileno(input), 0);
+    if (data != MAP_FAILED) {
+        madvise(data, length, MADV_SEQUENTIAL);
+        lexer->buffer = (char *)data;
+        lexer->bufferSize = length;
+        lexer->mapped = 1;
+    }
+#endif
+    if (!lexer->buffer) {
+        // No mmap available, read the whole file in one block instead
+        char *data = (char *)malloc(length);
+        if (!data) {
+            return;
+        }
+        size_t got = fread(data, 1, length - offset, input);
+        if (got != length - offset) {
+            free(data);
+            fseek(input, offset, SEEK_SET);
+            return;
+        }
+        lexer->buffer = data;
+        lexer->bufferSize = got;
+        lexer->cursor = data;
+        lexer->end = data + got;
+        return;
+    }
+    lexer->cursor = lexer->buffer + offset;
+    lexer->end = lexer->buffer + length;
+}
 
 void initLexer(Lexer *lexer, FILE *input) {
+    initScanner();
     lexer->input = input;
-    lexer->currentChar = fgetc(input); 
+    lexer->cursor = NULL;
+    lexer->end = NULL;
+    lexer->buffer = NULL;
+    lexer->bufferSize = 0;
+    lexer->mapped = 0;
+
+    // Regular files are scanned in memory; stdin and pipes stay on the stream path
+    struct stat st;
+    if (fstat(fileno(input), &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        loadInput(lexer, input, (size_t)st.st_size);
+    }
+    lexer->currentChar = nextChar(lexer);
 }
 
-char advance(Lexer *lexer) {
-    lexer->currentChar = fgetc(lexer->input);
+void initLexerFromBuffer(Lexer *lexer, const char *data, size_t length) {
+    initScanner();
+    lexer->input = NULL;
+    lexer->cursor = data;
+    lexer->end = data + length;
+    lexer->buffer = NULL;  // Caller owns the data
+    lexer->bufferSize = 0;
+    lexer->mapped = 0;
+    lexer->currentChar = nextChar(lexer);
+}
+
+void freeLexer(Lexer *lexer) {
+    if (lexer->buffer) {
+#ifndef _WIN32
+        if (lexer->mapped) {
+            munmap(lexer->buffer, lexer->bufferSize);
+        } else
+#endif
+        free(lexer->buffer);
+    }
+    lexer->buffer = NULL;
+    lexer->cursor = NULL;
+    lexer->end = NULL;
+}
+
+static inline char advance(Lexer *lexer) {
+    lexer->currentChar = nextChar(lexer);
     return lexer->currentChar;
 }
 
 void skipComments(Lexer *lexer) {
     if (lexer->currentChar == '/') {
-        skip_comments(lexer->input); 
-        lexer->currentChar = fgetc(lexer->input);  
+        if (lexer->cursor) {
+            lexer->cursor = skip_comments_buffer(lexer->cursor, lexer->end);
+        } else {
+            skip_comments(lexer->input); 
+        }
+        lexer->currentChar = nextChar(lexer);  
     }
 }
 
 void skipWhitespaceAndComments(Lexer *lexer) {
+    if (lexer->cursor) {
+        // Buffered input: skip whole runs at a time instead of byte by byte
+        while (isspace(lexer->currentChar) || lexer->currentChar == '/') {
+            if (lexer->currentChar == '/') {
+                lexer->cursor = skip_comments_buffer(lexer->cursor, lexer->end);
+            } else {
+                lexer->cursor = skipWhitespaceRun(lexer->cursor, lexer->end);
+            }
+            lexer->currentChar = nextChar(lexer);
+        }
+        return;
+    }
     while (isspace(lexer->currentChar) || lexer->currentChar == '/') {
         if (lexer->currentChar == '/') {
             skipComments(lexer); 
@@ -32,175 +136,134 @@ void skipWhitespaceAndComments(Lexer *lexer) {
 
 int readNumberFromLexer(Lexer *lexer) {
     int number = 0;
+    if (lexer->cursor && isdigit(lexer->currentChar)) {
+        // currentChar is the byte just before the cursor, so parse the run from there
+        lexer->cursor = parseDigitRun(lexer->cursor - 1, lexer->end, &number);
+        lexer->currentChar = nextChar(lexer);
+        return number;
+    }
     while (isdigit(lexer->currentChar)) {
         number = number * 10 + (lexer->currentChar - '0');
-        lexer->currentChar = fgetc(lexer->input); 
+        lexer->currentChar = nextChar(lexer); 
     }
     return number;
 }
 
-Token scanS(Lexer *lexer) {
-    advance(lexer);
-    if (lexer->currentChar == 't') return scanStore(lexer);
-    if (lexer->currentChar == 'u') return scanSub(lexer);
-    return (Token){INVALID, NOP};  
-}
-
-Token scanL(Lexer *lexer) {
-    advance(lexer);
-    if (lexer->currentChar == 'o') return scanLoad(lexer);
-    if (lexer->currentChar == 's') return scanShift(lexer, LSHIFT);
-    return (Token){INVALID, NOP};  
-}
-
-Token scanR(Lexer *lexer) {
-    advance(lexer);
-    if (isdigit((unsigned char)lexer->currentChar)) {
-        int regNum = lexer->currentChar - '0';
-        while (isdigit((unsigned char)advance(lexer))) {
-            regNum = regNum * 10 + (lexer->currentChar - '0');
-        }
-        return (Token){REGISTER, regNum};  
-    }
-    if (lexer->currentChar == 's') return scanShift(lexer, RSHIFT);
-    return (Token){INVALID, NOP};  
-}
+// Scanner DFA: a trie over every mnemonic in OPCODE_TABLE plus "=>" and ",".
+// Characters are folded into classes so each state row stays small. The start
+// state is never a transition target, so 0 doubles as the dead state.
+#define SCANNER_MAX_STATES 256
+#define SCANNER_MAX_CLASSES 64
+#define SCANNER_DEAD 0
 
-Token scanStore(Lexer *lexer) {
-    if (advance(lexer) == 'o') {
-        if (advance(lexer) == 'r') {
-            if (advance(lexer) == 'e') {
-                advance(lexer); 
-                return (Token){INSTRUCTION, STORE};  
-            }
-        }
-    }
-    return (Token){INVALID, NOP};  
-}
+typedef struct {
+    unsigned char charClass[256];                                  // Byte -> class (0 = no transition)
+    unsigned char next[SCANNER_MAX_STATES][SCANNER_MAX_CLASSES];   // Transition table, SCANNER_DEAD if none
+    Token accept[SCANNER_MAX_STATES];                      // Token produced if scanning stops here
+    int stateCount;
+    int classCount;
+    int registerState;                                     // State reached by "r", where digits start a register
+    int built;
+} ScannerTable;
 
-Token scanSub(Lexer *lexer) {
-    if (advance(lexer) == 'b') {
-        advance(lexer);  
-        return (Token){INSTRUCTION, SUB};  
-    }
-    return (Token){INVALID, NOP};  
-}
+static ScannerTable scanner;
 
-Token scanLoad(Lexer *lexer) {
-    if (advance(lexer) == 'a') {
-        if (advance(lexer) == 'd') {
-            if (advance(lexer) == 'I') {
-                advance(lexer);  
-                return (Token){INSTRUCTION, LOADI};  
-            }
-            advance(lexer);  
-            return (Token){INSTRUCTION, LOAD};  
-        }
+static int scannerClass(unsigned char c) {
+    if (!scanner.charClass[c]) {
+        assertCondition(scanner.classCount < SCANNER_MAX_CLASSES, "Too many scanner character classes");
+        scanner.charClass[c] = (unsigned char)scanner.classCount++;
     }
-    return (Token){INVALID, NOP};  
+    return scanner.charClass[c];
 }
 
-Token scanShift(Lexer *lexer, OpcodeType shiftType) {
-    if (advance(lexer) == 'h' && advance(lexer) == 'i' && advance(lexer) == 'f' && advance(lexer) == 't') {
-        advance(lexer);  
-        return (Token){INSTRUCTION, shiftType};  
+static int scannerNewState() {
+    assertCondition(scanner.stateCount < SCANNER_MAX_STATES, "Too many scanner states");
+    int state = scanner.stateCount++;
+    for (int c = 0; c < SCANNER_MAX_CLASSES; c++) {
+        scanner.next[state][c] = SCANNER_DEAD;
     }
-    return (Token){INVALID, NOP};  
+    scanner.accept[state] = (Token){INVALID, NOP};
+    return state;
 }
 
-Token scanOutput(Lexer *lexer) {
-    if (advance(lexer) == 'u') {
-        if (advance(lexer) == 't') {
-            if (advance(lexer) == 'p') {
-                if (advance(lexer) == 'u') {
-                    if (advance(lexer) == 't') {
-                        advance(lexer);  
-                        return (Token){INSTRUCTION, OUTPUT};  
-                    }
-                }
-            }
+// Adds the path for text to the trie and returns its final state
+static int scannerAddWord(const char *text) {
+    int state = 0;
+    for (const char *p = text; *p; p++) {
+        int c = scannerClass((unsigned char)*p);
+        if (scanner.next[state][c] == SCANNER_DEAD) {
+            scanner.next[state][c] = (unsigned char)scannerNewState();
         }
+        state = scanner.next[state][c];
     }
-    return (Token){INVALID, NOP};  
+    return state;
 }
 
-Token scanNop(Lexer *lexer) {
-    if (advance(lexer) == 'o' && advance(lexer) == 'p') {
-        advance(lexer); 
-        return (Token){INSTRUCTION, NOP};  
+void initScanner() {
+    if (scanner.built) {
+        return;
     }
-    return (Token){INVALID, NOP}; 
-}
+    scanner.classCount = 1;  // Class 0 is reserved for bytes with no transition
+    scanner.stateCount = 0;
+    scannerNewState();       // Start state
 
-Token scanMult(Lexer *lexer) {
-    if (advance(lexer) == 'u') {
-        if (advance(lexer) == 'l') {
-            if (advance(lexer) == 't') {
-                advance(lexer);  
-                return (Token){INSTRUCTION, MULT};  
-            }
-        }
-    }
-    return (Token){INVALID, NOP};  
-}
-
-Token scanAdd(Lexer *lexer) {
-    if (advance(lexer) == 'd') {
-        if (advance(lexer) == 'd') {
-            advance(lexer);  
-            return (Token){INSTRUCTION, ADD}; 
-        }
-    }
-    return (Token){INVALID, NOP};  
+#define X(name, text) scanner.accept[scannerAddWord(text)] = (Token){INSTRUCTION, name};
+    OPCODE_TABLE(X)
+#undef X
+    scanner.accept[scannerAddWord("=>")] = (Token){ARROW, 0};
+    scanner.accept[scannerAddWord(",")] = (Token){COMMA, 0};
+    scanner.registerState = scannerAddWord("r");
+    scanner.built = 1;
 }
 
 Token getNextToken(Lexer *lexer) {
-    Token token;
-    token.cat = INVALID;
-    token.val = NOP;  
-
     skipWhitespaceAndComments(lexer);  
 
     if (lexer->currentChar == EOF) {
-        token.cat = EOF_TOKEN;
-        return token;
-    }
-
-    switch (lexer->currentChar) {
-        case 'l':
-            return scanL(lexer);
-        case 's':
-            return scanS(lexer);
-        case 'r':
-            return scanR(lexer);
-        case 'm':
-            return scanMult(lexer);  
-        case 'a':
-            return scanAdd(lexer);   
-        case 'n':
-            return scanNop(lexer);   
-        case 'o':
-            return scanOutput(lexer); 
-        case '=':
-            advance(lexer);
-            if (lexer->currentChar == '>') {
-                advance(lexer);  
-                return (Token){ARROW, 0};  
+        return (Token){EOF_TOKEN, NOP};
+    }
+    if (isdigit(lexer->currentChar)) {
+        int value = readNumberFromLexer(lexer);
+        return (Token){CONSTANT, value};
+    }
+
+    // Follow transitions until the next byte has none; currentChar is then the first unused byte
+    int state = 0;
+    if (lexer->cursor) {
+        const char *p = lexer->cursor - 1;  // currentChar is the byte before the cursor
+        while (p < lexer->end) {
+            int next = scanner.next[state][scanner.charClass[(unsigned char)*p]];
+            if (next == SCANNER_DEAD) {
+                break;
             }
-            break;
-        case ',':
+            state = next;
+            p++;
+        }
+        if (state != 0) {
+            lexer->cursor = p;
             advance(lexer);
-            return (Token){COMMA, 0};  
-        default:
-            if (isdigit(lexer->currentChar)) {
-                token.cat = CONSTANT;
-                token.val = readNumberFromLexer(lexer);  
-            } else {
-                advance(lexer);  
+        }
+    } else {
+        while (lexer->currentChar != EOF) {
+            int next = scanner.next[state][scanner.charClass[(unsigned char)lexer->currentChar]];
+            if (next == SCANNER_DEAD) {
+                break;
             }
+            state = next;
+            advance(lexer);
+        }
     }
 
-    return token;
+    if (state == 0) {
+        // No token starts with this byte: drop it
+        advance(lexer);
+        return (Token){INVALID, NOP};
+    }
+    if (state == scanner.registerState && isdigit(lexer->currentChar)) {
+        int regNum = readNumberFromLexer(lexer);
+        return (Token){REGISTER, regNum};
+    }
+    return scanner.accept[state];  // INVALID unless state completes a token
 }
 
 void printToken(Token token) {
@@ -2,6 +2,7 @@
 #define LEXER_H
 
 #include <stdio.h>
+#include <stddef.h>
 #include "opcodes.h"  
 
 typedef enum {
@@ -16,23 +17,20 @@ typedef struct {
 typedef struct {
     FILE *input;    
     int currentChar; 
+    const char *cursor;  // Next unread byte when scanning a buffer (NULL in stream mode)
+    const char *end;     // One past the last byte of the buffer
+    char *buffer;        // Buffer owned by the lexer (mapped or read), released by freeLexer
+    size_t bufferSize;   // Size of the owned buffer in bytes
+    int mapped;          // 1 if buffer was obtained with mmap
 } Lexer;
 
 
 void initLexer(Lexer *lexer, FILE *input);
+void initLexerFromBuffer(Lexer *lexer, const char *data, size_t length);
+void freeLexer(Lexer *lexer);
 Token getNextToken(Lexer *lexer);
 void printToken(Token token);
 
-Token scanS(Lexer *lexer);
-Token scanStore(Lexer *lexer);
-Token scanSub(Lexer *lexer);
-Token scanL(Lexer *lexer);
-Token scanLoad(Lexer *lexer);
-Token scanShift(Lexer *lexer, OpcodeType shiftType);
-Token scanR(Lexer *lexer);
-Token scanMult(Lexer *lexer);
-Token scanAdd(Lexer *lexer);
-Token scanNop(Lexer *lexer);
-Token scanOutput(Lexer *lexer);
+void initScanner();
 
 #endif
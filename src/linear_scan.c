@@ -0,0 +1,149 @@
+#include "linear_scan.h"
+#include "heap.h"
+#include "utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// Registers currently held, ordered by the end of their interval (latest first)
+typedef struct {
+    Allocator *allocator;
+    const VRInfo *info;
+    IndexedHeap active;     // PRs holding a whole interval, keyed on -lastUse
+    char *spilled;          // VRs that lost their register for good
+    int *locked;            // Instruction that last pinned each PR
+    int *skipped;           // Scratch for locked PRs set aside while picking a victim
+} LinearScan;
+
+static void releasePR(LinearScan *scan, int pr) {
+    Allocator *allocator = scan->allocator;
+    int vr = allocator->PRtoVR[pr];
+    allocator->VRtoPR[vr] = -1;
+    allocator->PRtoVR[pr] = -1;
+    heapRemove(&scan->active, pr);
+    allocator->freePRs[allocator->freePRsCount++] = pr;
+}
+
+#define NO_PIN -2  // Matches no instruction, so takePR may evict anything
+
+// Returns a free PR, evicting the active interval that ends last if there is none.
+// PRs pinned by instruction i are never evicted.
+static int takePR(LinearScan *scan, int i) {
+    Allocator *allocator = scan->allocator;
+    if (allocator->freePRsCount > 0) {
+        return allocator->freePRs[--allocator->freePRsCount];
+    }
+
+    int skipped = 0;
+    int victim;
+    while ((victim = heapPop(&scan->active)) != -1 && scan->locked[victim] == i) {
+        scan->skipped[skipped++] = victim;
+    }
+    for (int s = 0; s < skipped; s++) {
+        int pr = scan->skipped[s];
+        heapSet(&scan->active, pr, scan->active.key[pr]);
+    }
+    if (victim == -1) {
+        printf("Error: No PR available to spill\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // The rest of the victim's interval lives in memory; only dirty values need storing
+    int vr = allocator->PRtoVR[victim];
+    if (scan->info[vr].cost == SPILL_DIRTY) {
+        emitSpillStore(allocator, vr, victim);
+    }
+    scan->spilled[vr] = 1;
+    allocator->VRtoPR[vr] = -1;
+    allocator->PRtoVR[victim] = -1;
+    return victim;
+}
+
+static void bindPR(LinearScan *scan, int vr, int pr) {
+    scan->allocator->VRtoPR[vr] = pr;
+    scan->allocator->PRtoVR[pr] = vr;
+}
+
+void allocateRegistersLinear(Allocator *allocator) {
+    IR *ir = allocator->ir;
+    int k = allocator->k;
+    int vrCount = allocator->vrCount > 0 ? allocator->vrCount : 1;
+    if (k < 3) {
+        printf("Error: Linear scan needs at least 3 registers\n");
+        exit(EXIT_FAILURE);
+    }
+
+    LinearScan scan;
+    scan.allocator = allocator;
+    scan.info = computeVRInfo(allocator);
+    scan.spilled = (char *)arenaAlloc(&allocator->arena, vrCount);
+    scan.locked = (int *)arenaAlloc(&allocator->arena, k * sizeof(int));
+    scan.skipped = (int *)arenaAlloc(&allocator->arena, k * sizeof(int));
+    initIndexedHeap(&scan.active, k, &allocator->arena);
+    for (int v = 0; v < vrCount; v++) {
+        scan.spilled[v] = 0;
+    }
+    for (int pr = 0; pr < k; pr++) {
+        scan.locked[pr] = -1;
+    }
+
+    for (int i = 0; i < ir->count; i++) {
+        int srcs[2] = {ir->src1.vr[i], ir->src2.vr[i]};
+        int prs[3] = {0, 0, 0};
+
+        // Sources: pin the ones in registers, reload spilled ones for this instruction only
+        for (int j = 0; j < 2; j++) {
+            int vr = srcs[j];
+            if (vr == -1) {
+                continue;
+            }
+            if (j == 1 && vr == srcs[0]) {
+                prs[1] = prs[0];
+                continue;
+            }
+            int pr = allocator->VRtoPR[vr];
+            if (pr == -1) {
+                pr = takePR(&scan, i);
+                bindPR(&scan, vr, pr);
+                if (scan.spilled[vr]) {
+                    emitRestore(allocator, scan.info, vr, pr);
+                } else {
+                    heapSet(&scan.active, pr, -scan.info[vr].lastUse);  // Live on entry: its interval starts here
+                }
+            }
+            scan.locked[pr] = i;
+            prs[j] = pr;
+        }
+
+        // Intervals ending here, and reloaded copies, give their registers back before the def
+        for (int j = 0; j < 2; j++) {
+            int vr = srcs[j];
+            if (vr == -1 || (j == 1 && vr == srcs[0])) {
+                continue;
+            }
+            if (scan.spilled[vr] || scan.info[vr].lastUse == i) {
+                releasePR(&scan, prs[j]);
+            }
+            if (scan.info[vr].lastUse == i) {
+                releaseSpillSlot(allocator, vr);
+            }
+        }
+
+        int dst = ir->dst.vr[i];
+        if (dst != -1) {
+            int pr = takePR(&scan, NO_PIN);  // Sources are read before the def, so any PR may go
+            prs[2] = pr;
+            if (scan.info[dst].lastUse > i) {
+                bindPR(&scan, dst, pr);
+                heapSet(&scan.active, pr, -scan.info[dst].lastUse);
+            } else {
+                allocator->freePRs[allocator->freePRsCount++] = pr;  // Never read
+            }
+        }
+
+        IRLine line = getIRLine(ir, i);
+        line.src1.pr = prs[0];
+        line.src2.pr = prs[1];
+        line.dst.pr = prs[2];
+        addToIR(&allocator->finalIR, line);
+    }
+}
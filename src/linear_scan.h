@@ -0,0 +1,14 @@
+#ifndef LINEAR_SCAN_H
+#define LINEAR_SCAN_H
+
+#include "allocator.h"
+
+/**
+ * Allocates registers with Poletto/Sarkar linear scan in one forward pass over the block.
+ * Each VR's interval runs from its def to its last use. When no PR is free, the active
+ * interval that ends last loses its register for the rest of its life; afterwards each use
+ * reloads it for that one instruction. Requires computeLastUse; the result is left in finalIR.
+ */
+void allocateRegistersLinear(Allocator *allocator);
+
+#endif
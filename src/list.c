@@ -1,6 +1,6 @@
 #include "list.h"
 #include "utils.h"
-#include "ir.h"
+#include "IR.h"
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -0,0 +1,127 @@
+#include "loads.h"
+#include "alias.h"
+#include "lvn.h"
+#include "opcodes.h"
+#include "utils.h"
+#include <stdlib.h>
+
+// The SR known to hold the word at one address
+typedef struct HeldWord {
+    int sr;
+    int version;    // Definitions of sr seen when it took the word; stale once sr is redefined
+    int epoch;      // Stores to unknown addresses seen then; stale after the next one
+    int stored;     // Whether a store put it there, rather than a load
+} HeldWord;
+
+int eliminateLoads(IR *ir) {
+    int count = ir->count;
+    int registers = getMaxSR(ir);
+    int size = count > 0 ? count : 1;
+    int *address = (int *)malloc(size * sizeof(int));
+    int *lastRead = (int *)malloc(size * sizeof(int));
+    int *nextDef = (int *)malloc(size * sizeof(int));
+    char *keep = (char *)malloc(size);
+    HeldWord *held = (HeldWord *)malloc(size * sizeof(HeldWord));  // One per distinct address at most
+    int *firstDef = (int *)malloc((registers > 0 ? registers : 1) * sizeof(int));
+    int *alias = (int *)malloc((registers > 0 ? registers : 1) * sizeof(int));      // SR that reads of each SR are sent to
+    int *currentDef = (int *)malloc((registers > 0 ? registers : 1) * sizeof(int)); // Instruction that defined each SR's value
+    int *version = (int *)calloc(registers > 0 ? registers : 1, sizeof(int));
+    assertCondition(address && lastRead && nextDef && keep && held && firstDef && alias && currentDef && version,
+                    "Failed to allocate load elimination tables");
+    AddressMap words;  // Index into held for each known address
+    initAddressMap(&words, count);
+    int heldCount = 0;
+
+    computeAddresses(ir, address);
+    computeDefRanges(ir, lastRead, nextDef, firstDef);
+    for (int sr = 0; sr < registers; sr++) {
+        alias[sr] = -1;
+        currentDef[sr] = -1;
+    }
+
+    int epoch = 0;
+    int forwarded = 0;
+    int repeated = 0;
+    for (int i = 0; i < count; i++) {
+        int op = ir->opcode[i];
+        keep[i] = 1;
+        if (ir->src1.sr[i] != -1 && alias[ir->src1.sr[i]] != -1) {
+            ir->src1.sr[i] = alias[ir->src1.sr[i]];
+        }
+        if (ir->src2.sr[i] != -1 && alias[ir->src2.sr[i]] != -1) {
+            ir->src2.sr[i] = alias[ir->src2.sr[i]];
+        }
+
+        if (isStoreOp(op)) {
+            if (address[i] == ADDRESS_UNKNOWN) {
+                epoch++;  // Every remembered word may now be stale
+                continue;
+            }
+            // Words overlapping the stored one are lost; the stored one is now held by the value
+            for (int a = address[i] - (WORD_BYTES - 1); a <= address[i] + (WORD_BYTES - 1); a++) {
+                int slot = addressValue(&words, a);
+                if (slot != -1) {
+                    held[slot].epoch = -1;
+                }
+            }
+            int *slot = addressEntry(&words, address[i]);
+            if (*slot == -1) {
+                *slot = heldCount++;
+            }
+            int value = ir->src1.sr[i];
+            held[*slot] = (HeldWord){value, version[value], epoch, 1};
+            continue;
+        }
+
+        int dst = ir->dst.sr[i];
+        if (isLoadOp(op) && address[i] != ADDRESS_UNKNOWN) {
+            int *slot = addressEntry(&words, address[i]);
+            if (*slot == -1) {
+                *slot = heldCount++;
+                held[*slot].epoch = -1;
+            }
+            HeldWord *word = &held[*slot];
+            if (word->epoch == epoch && version[word->sr] == word->version) {
+                int holder = word->sr;
+                // The holder must keep the word until the last read of this load
+                int redefined = (currentDef[holder] == -1) ? firstDef[holder] : nextDef[currentDef[holder]];
+                if (holder == dst || redefined >= lastRead[i]) {
+                    keep[i] = 0;
+                    if (word->stored) {
+                        forwarded++;
+                    } else {
+                        repeated++;
+                    }
+                    if (holder != dst) {
+                        version[dst]++;  // Words dst held are gone in the original block
+                        alias[dst] = holder;
+                        currentDef[dst] = i;
+                    }
+                    continue;
+                }
+            }
+            *word = (HeldWord){dst, version[dst] + 1, epoch, 0};
+        }
+
+        if (dst != -1) {
+            version[dst]++;
+            alias[dst] = -1;
+            currentDef[dst] = i;
+        }
+    }
+
+    int removed = compactIR(ir, keep);
+    debug(1, "Forwarded %d stored values to loads, removed %d repeated loads", forwarded, repeated);
+
+    freeAddressMap(&words);
+    free(address);
+    free(lastRead);
+    free(nextDef);
+    free(keep);
+    free(held);
+    free(firstDef);
+    free(alias);
+    free(currentDef);
+    free(version);
+    return removed;
+}
@@ -0,0 +1,16 @@
+#ifndef LOADS_H
+#define LOADS_H
+
+#include "IR.h"
+
+/**
+ * Redundant load elimination over the source registers of a freshly parsed block. Remembers,
+ * for every known address (see computeAddresses), which SR holds the word stored there: the
+ * value of the last store to it, or the result of the last load from it. A later load of that
+ * address is deleted and its readers read that SR instead, as long as no store that may alias
+ * the address comes in between and the SR is not redefined before the load's last read.
+ * Returns the number of loads removed.
+ */
+int eliminateLoads(IR *ir);
+
+#endif
@@ -0,0 +1,189 @@
+#include "lvn.h"
+#include "opcodes.h"
+#include "utils.h"
+#include <stdint.h>
+#include <stdlib.h>
+
+#define NO_VALUE -2  // Value number of a register whose reads were redirected elsewhere
+
+// One remembered expression and the register that last computed it
+typedef struct ValueEntry {
+    int opcode;
+    int a, b;       // Operand value numbers, or the loadI constant in a
+    int epoch;      // Stores seen before a load; 0 for everything else
+    int vn;         // Value number of the result
+    int holder;     // SR last defined with this value; stale once that SR is redefined
+    int used;
+} ValueEntry;
+
+typedef struct ValueTable {
+    ValueEntry *entries;
+    size_t mask;
+} ValueTable;
+
+static ValueEntry *findEntry(ValueTable *table, int opcode, int a, int b, int epoch) {
+    uint64_t hash = (uint64_t)(unsigned)opcode * 0x9E3779B97F4A7C15ULL;
+    hash = (hash ^ (unsigned)a) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (unsigned)b) * 0x94D049BB133111EBULL;
+    hash = (hash ^ (unsigned)epoch) * 0x9E3779B97F4A7C15ULL;
+    size_t slot = (size_t)(hash >> 32) & table->mask;
+    for (;;) {
+        ValueEntry *entry = &table->entries[slot];
+        if (!entry->used) {
+            *entry = (ValueEntry){opcode, a, b, epoch, -1, -1, 1};
+            return entry;
+        }
+        if (entry->opcode == opcode && entry->a == a && entry->b == b && entry->epoch == epoch) {
+            return entry;
+        }
+        slot = (slot + 1) & table->mask;
+    }
+}
+
+void computeDefRanges(const IR *ir, int *lastRead, int *nextDef, int *firstDef) {
+    int registers = getMaxSR(ir);
+    int *pendingRead = (int *)malloc((registers > 0 ? registers : 1) * sizeof(int));
+    assertCondition(pendingRead != NULL, "Failed to allocate read table");
+    for (int sr = 0; sr < registers; sr++) {
+        firstDef[sr] = ir->count;
+        pendingRead[sr] = -1;
+    }
+    for (int i = ir->count - 1; i >= 0; i--) {
+        int dst = ir->dst.sr[i];
+        if (dst != -1) {
+            lastRead[i] = pendingRead[dst];
+            nextDef[i] = firstDef[dst];
+            pendingRead[dst] = -1;
+            firstDef[dst] = i;
+        }
+        if (ir->src1.sr[i] != -1 && pendingRead[ir->src1.sr[i]] == -1) {
+            pendingRead[ir->src1.sr[i]] = i;
+        }
+        if (ir->src2.sr[i] != -1 && pendingRead[ir->src2.sr[i]] == -1) {
+            pendingRead[ir->src2.sr[i]] = i;
+        }
+    }
+    free(pendingRead);
+}
+
+int numberValues(IR *ir) {
+    int count = ir->count;
+    int registers = getMaxSR(ir);
+    int *valueOf = (int *)malloc(registers * sizeof(int));    // Value number each SR holds
+    int *alias = (int *)malloc(registers * sizeof(int));      // SR that reads of each SR are sent to
+    int *currentDef = (int *)malloc(registers * sizeof(int)); // Instruction that defined each SR's value
+    int *firstDef = (int *)malloc(registers * sizeof(int));   // First definition of each SR
+    int *lastRead = (int *)malloc((count > 0 ? count : 1) * sizeof(int));  // Last read of each def's value
+    int *nextDef = (int *)malloc((count > 0 ? count : 1) * sizeof(int));   // Next def of the same SR
+    char *keep = (char *)malloc(count > 0 ? count : 1);
+    ValueTable table;
+    table.mask = 1024;
+    while (table.mask < (size_t)count * 2) {
+        table.mask *= 2;
+    }
+    table.entries = (ValueEntry *)calloc(table.mask, sizeof(ValueEntry));
+    table.mask -= 1;
+    assertCondition(valueOf && alias && currentDef && firstDef && lastRead && nextDef && keep && table.entries,
+                    "Failed to allocate value numbering tables");
+
+    // Backward: how long each definition's value is read, and where its SR is next redefined
+    computeDefRanges(ir, lastRead, nextDef, firstDef);
+
+    // Forward: number every value and drop the recomputations
+    for (int sr = 0; sr < registers; sr++) {
+        valueOf[sr] = -1;
+        alias[sr] = -1;
+        currentDef[sr] = -1;
+    }
+    int nextVN = 0;
+    int epoch = 0;
+    int removed = 0;
+    for (int i = 0; i < count; i++) {
+        int op = ir->opcode[i];
+        keep[i] = 1;
+
+        // Redirect reads first, then number the operands (a register live on entry gets a fresh number)
+        OperandColumns *srcs[2] = {&ir->src1, &ir->src2};
+        int vns[2] = {0, 0};
+        for (int j = 0; j < 2; j++) {
+            int sr = srcs[j]->sr[i];
+            if (sr == -1) {
+                continue;
+            }
+            if (alias[sr] != -1) {
+                sr = alias[sr];
+                srcs[j]->sr[i] = sr;
+            }
+            if (valueOf[sr] == -1) {
+                valueOf[sr] = nextVN++;
+            }
+            vns[j] = valueOf[sr];
+        }
+
+        if (isStoreOp(op)) {
+            epoch++;  // Every remembered load may now be stale
+            continue;
+        }
+        int dst = ir->dst.sr[i];
+        if (dst == -1) {
+            continue;
+        }
+
+        ValueEntry *entry;
+        if (op == LOADI) {
+            entry = findEntry(&table, LOADI, ir->imm[i], 0, 0);
+        } else if (op == LOAD) {
+            entry = findEntry(&table, LOAD, vns[0], 0, epoch);
+        } else if (op == LOADAI) {
+            entry = findEntry(&table, LOADAI, vns[0], ir->imm[i], epoch);
+        } else if (isImmediateOp(op)) {
+            entry = findEntry(&table, op, vns[0], ir->imm[i], 0);
+        } else if (op == ADD || op == MULT) {
+            int low = vns[0] < vns[1] ? vns[0] : vns[1];
+            int high = vns[0] < vns[1] ? vns[1] : vns[0];
+            entry = findEntry(&table, op, low, high, 0);
+        } else {
+            entry = findEntry(&table, op, vns[0], vns[1], 0);
+        }
+
+        int holder = entry->holder;
+        if (op != LOADI && holder != -1 && valueOf[holder] == entry->vn) {
+            if (holder == dst) {
+                keep[i] = 0;  // dst already holds this value
+                removed++;
+                continue;
+            }
+            // The holder must keep the value until the last read of this result
+            int redefined = (currentDef[holder] == -1) ? firstDef[holder] : nextDef[currentDef[holder]];
+            if (redefined >= lastRead[i]) {
+                keep[i] = 0;
+                removed++;
+                alias[dst] = holder;
+                valueOf[dst] = NO_VALUE;
+                currentDef[dst] = i;
+                continue;
+            }
+        }
+
+        if (entry->vn == -1) {
+            entry->vn = nextVN++;
+        }
+        entry->holder = dst;
+        valueOf[dst] = entry->vn;
+        alias[dst] = -1;
+        currentDef[dst] = i;
+    }
+
+    compactIR(ir, keep);
+    debug(1, "Value numbering removed %d redundant instructions", removed);
+
+    free(valueOf);
+    free(alias);
+    free(currentDef);
+    free(firstDef);
+    free(lastRead);
+    free(nextDef);
+    free(keep);
+    free(table.entries);
+    return removed;
+}
@@ -0,0 +1,26 @@
+#ifndef LVN_H
+#define LVN_H
+
+#include "IR.h"
+
+/**
+ * Local value numbering over the source registers of a freshly parsed block. Each value gets a
+ * number from its opcode and operand numbers (add and mult sort theirs, loadI uses its constant,
+ * load also the number of stores before it, so a store invalidates every remembered load).
+ * An add, sub, mult, lshift, rshift or load whose value is still held by another register is
+ * deleted, and later reads of its result read that register instead. The replacement is skipped
+ * when that register is redefined before the result's last read. loadIs are kept, since reusing
+ * a constant would only stretch a live range the allocator can rematerialize for free.
+ * Returns the number of instructions removed.
+ */
+int numberValues(IR *ir);
+
+/**
+ * Backward pass shared by the passes that redirect reads from one SR to another. For every
+ * instruction i defining an SR, lastRead[i] is the last read of that value (-1 if none) and
+ * nextDef[i] the next definition of the same SR (ir->count if none). firstDef holds the first
+ * definition of each SR, indexed up to getMaxSR.
+ */
+void computeDefRanges(const IR *ir, int *lastRead, int *nextDef, int *firstDef);
+
+#endif
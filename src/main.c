@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <getopt.h>
 #include "utils.h"
 #include "lexer.h"
@@ -7,38 +8,81 @@
 #include "IR.h"
 #include "allocator.h"
 #include "scheduler.h"
+#include "emit.h"
+#include "optimal.h"
+#include "sweep.h"
+#include "stats.h"
+#include "fold.h"
+#include "lvn.h"
+#include "loads.h"
+#include "dce.h"
+#include "select.h"
+
+// Everything the command line selects, so process_file takes one argument instead of a long list
+typedef struct Options {
+    int lexer, pretty, table, alloc, sched, debug;  // Mode flags
+    int registers;          // k
+    int threads;            // -j
+    AllocMode alloc_mode;
+    SearchBudget budget;    // Limits for --alloc=optimal
+    SweepRange sweep;       // first == 0 unless --sweep is given
+    StatsFormat stats_format;
+    int fold, lvn, loads, select, dce;  // Passes run before allocation, all opt-in
+    int frame;              // Spill code addresses slots from PR0 with loadAI/storeAI
+} Options;
 
 // Function declarations
 void print_help();
-void process_file(char *filename, int flag_lexer, int flag_pretty, int flag_table, int flag_alloc, int num_registers, int flag_debug, int flag_sched);
+void process_file(char *filename, const Options *options);
 
 // Main function
 int main(int argc, char **argv) {
     int opt;
-    int flag_debug = 0, flag_lexer = 0, flag_pretty = 0, flag_table = 0, flag_alloc = 1, flag_sched = 0;  // Default is allocator (-a)
-    int num_registers = 4;  // Default register count
+    Options options = {
+        .alloc = 1,                         // Default is allocator (-a)
+        .registers = 4,                     // Default register count
+        .threads = 1,                       // Default to a serial parse
+        .alloc_mode = ALLOC_LOCAL,          // Default to the bottom-up allocator
+        .budget = {OPT_DEFAULT_NODES, OPT_DEFAULT_MILLIS},
+        .sweep = {0, 0, 0},                 // No sweep unless --sweep is given
+        .stats_format = STATS_NONE,         // No allocation report unless --stats is given
+    };
+    char *output_name = NULL;  // Default to stdout
     
     struct option long_options[] = {
         {"lexer", no_argument, NULL, 'l'},
         {"pretty-print", optional_argument, NULL, 'p'},
         {"table-print", no_argument, NULL, 't'},
-        {"alloc", no_argument, NULL, 'a'},
+        {"alloc", optional_argument, NULL, 'a'},
         {"sched", no_argument, NULL, 's'}, // Add the scheduling flag
         {"registers", required_argument, NULL, 'k'},
+        {"jobs", required_argument, NULL, 'j'},
+        {"output", required_argument, NULL, 'o'},
+        {"opt-nodes", required_argument, NULL, 'N'},
+        {"opt-ms", required_argument, NULL, 'M'},
+        {"sweep", required_argument, NULL, 'S'},
+        {"sweep-code", no_argument, NULL, 'C'},
+        {"stats", optional_argument, NULL, 'R'},
+        {"fold", no_argument, NULL, 'F'},
+        {"lvn", no_argument, NULL, 'V'},
+        {"loads", no_argument, NULL, 'L'},
+        {"select", no_argument, NULL, 'I'},
+        {"dce", no_argument, NULL, 'D'},
+        {"frame", no_argument, NULL, 'P'},
         {"help", no_argument, NULL, 'h'},
         {"debug", no_argument, NULL, 'd'},
         {NULL, 0, NULL, 0}
     };
 
-    while ((opt = getopt_long(argc, argv, "lptask:hd", long_options, NULL)) != -1) {
+    while ((opt = getopt_long(argc, argv, "lptask:j:o:hd", long_options, NULL)) != -1) {
         switch (opt) {
             case 'l':
-                flag_lexer = 1;
-                flag_alloc = 0;  // Disable allocator when lexer flag is set
+                options.lexer = 1;
+                options.alloc = 0;  // Disable allocator when lexer flag is set
                 break;
             case 'p':
-                flag_pretty = 1;
-                flag_alloc = 0;  // Disable allocator when pretty-print flag is set
+                options.pretty = 1;
+                options.alloc = 0;  // Disable allocator when pretty-print flag is set
                 if (optarg) {
                     // Optional parameter for pretty-print to specify register type
                     // (e.g., source, virtual, physical), handle it if required
@@ -46,29 +90,105 @@ int main(int argc, char **argv) {
                 }
                 break;
             case 't':
-                flag_table = 1;  // Enable table-print explicitly
-                flag_alloc = 0;  // Disable allocator when table-print flag is set
+                options.table = 1;  // Enable table-print explicitly
+                options.alloc = 0;  // Disable allocator when table-print flag is set
                 break;
             case 'a':
-                flag_alloc = 1;   // Enable register allocation explicitly
+                options.alloc = 1;   // Enable register allocation explicitly
+                if (optarg) {
+                    // --alloc=<mode> picks the allocation strategy
+                    if (strcmp(optarg, "local") == 0) {
+                        options.alloc_mode = ALLOC_LOCAL;
+                    } else if (strcmp(optarg, "color") == 0) {
+                        options.alloc_mode = ALLOC_COLOR;
+                    } else if (strcmp(optarg, "linear") == 0) {
+                        options.alloc_mode = ALLOC_LINEAR;
+                    } else if (strcmp(optarg, "optimal") == 0) {
+                        options.alloc_mode = ALLOC_OPTIMAL;
+                    } else {
+                        fprintf(stderr, "Error: Unknown allocator %s\n", optarg);
+                        exit(EXIT_FAILURE);
+                    }
+                }
                 break;
             case 'k':
-                num_registers = atoi(optarg);  // Set number of registers for allocation
-                if (num_registers <= 0) {
+                options.registers = atoi(optarg);  // Set number of registers for allocation
+                if (options.registers <= 0) {
                     fprintf(stderr, "Error: Number of registers must be positive.\n");
                     exit(EXIT_FAILURE);
                 }
                 break;
+            case 'j':
+                options.threads = atoi(optarg);  // Set number of parser threads
+                if (options.threads <= 0) {
+                    fprintf(stderr, "Error: Number of threads must be positive.\n");
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            case 'o':
+                output_name = optarg;  // Write results straight to this file
+                break;
+            case 'N':
+                options.budget.nodes = atol(optarg);  // Search nodes for --alloc=optimal
+                if (options.budget.nodes <= 0) {
+                    fprintf(stderr, "Error: Node budget must be positive.\n");
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            case 'M':
+                options.budget.millis = atol(optarg);  // Search time for --alloc=optimal
+                if (options.budget.millis <= 0) {
+                    fprintf(stderr, "Error: Time budget must be positive.\n");
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            case 'S':
+                options.alloc = 1;  // Sweep allocates once per k
+                if (sscanf(optarg, "%d..%d", &options.sweep.first, &options.sweep.last) != 2 || options.sweep.first <= 0 || options.sweep.last < options.sweep.first) {
+                    fprintf(stderr, "Error: Sweep range must look like k1..k2 with 0 < k1 <= k2.\n");
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            case 'C':
+                options.sweep.emitCode = 1;  // Print the allocated block for every k of the sweep
+                break;
+            case 'R':
+                options.stats_format = STATS_TEXT;  // Report allocation quality on stderr
+                if (optarg && strcmp(optarg, "json") == 0) {
+                    options.stats_format = STATS_JSON;
+                } else if (optarg && strcmp(optarg, "text") != 0) {
+                    fprintf(stderr, "Error: Unknown stats format %s\n", optarg);
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            case 'F':
+                options.fold = 1;  // Fold constant arithmetic before allocation
+                break;
+            case 'V':
+                options.lvn = 1;  // Remove recomputed values before allocation
+                break;
+            case 'L':
+                options.loads = 1;  // Forward stored values and drop repeated loads before allocation
+                break;
+            case 'I':
+                options.select = 1;  // Use addI, multI, ... for constant operands before allocation
+                break;
+            case 'P':
+                options.frame = 1;  // One loadAI/storeAI per spill operation instead of loadI plus load/store
+                break;
+            case 'D':
+                options.dce = 1;  // Drop dead computations and overwritten stores before allocation
+                break;
             case 'h':
                 print_help();
                 exit(0);
             case 'd':
-                flag_debug = 1;  // Enable debugging mode
+                options.debug = 1;  // Enable debugging mode
                 
                 break;
             case 's':
-                flag_sched = 1;
-                flag_alloc = 0;  // Disable allocator when scheduling is active
+                options.sched = 1;
+                options.alloc = 0;  // Disable allocator when scheduling is active
                 break;
             default:
                 print_help();
@@ -86,12 +206,18 @@ int main(int argc, char **argv) {
     char *filename = argv[optind];
 
     // Default to allocator if no print flag is set
-    if (!flag_lexer && !flag_pretty && !flag_table && !flag_sched) {
-        flag_alloc = 1;
+    if (!options.lexer && !options.pretty && !options.table && !options.sched) {
+        options.alloc = 1;
+    }
+
+    // Send everything that would go to stdout into the output file instead
+    if (output_name && !freopen(output_name, "w", stdout)) {
+        fprintf(stderr, "Error: Unable to open output file %s\n", output_name);
+        exit(EXIT_FAILURE);
     }
 
     // Process the file with the specified flags
-    process_file(filename, flag_lexer, flag_pretty, flag_table, flag_alloc, num_registers, flag_debug, flag_sched);
+    process_file(filename, &options);
 
     return 0;
 }
@@ -99,22 +225,39 @@ int main(int argc, char **argv) {
 // Function to print the help message
 void print_help() {
     printf("Usage: ./thc [options] filename\n");
+    printf("       (use - as filename to read the block from stdin)\n");
     printf("Options:\n");
     printf("  -l, --lexer                Print list of tokens\n");
     printf("  -p, --pretty-print [reg]   Pretty print ILOC code (optional: reg type)\n");
     printf("  -t, --table-print          Print IR in tabular form\n");
-    printf("  -a, --alloc                Perform register allocation on the block (default if no print flags)\n");
+    printf("  -a, --alloc[=mode]         Perform register allocation on the block (default if no print flags)\n");
+    printf("                             mode: local (default), color (Chaitin-Briggs graph coloring)\n");
+    printf("                             linear (linear scan, fastest compile) or optimal (exact search)\n");
+    printf("      --opt-nodes num        Search nodes for --alloc=optimal (default %ld)\n", OPT_DEFAULT_NODES);
+    printf("      --opt-ms num           Search milliseconds for --alloc=optimal (default %ld)\n", OPT_DEFAULT_MILLIS);
+    printf("      --stats[=fmt]          Report allocation quality on stderr; fmt: text (default) or json\n");
+    printf("      --fold                 Fold arithmetic on known constants into loadI before allocation\n");
+    printf("      --lvn                  Remove redundant computations and loads by local value numbering\n");
+    printf("      --loads                Forward stored values to loads of known addresses and drop repeated loads\n");
+    printf("      --select               Use immediate forms (addI, multI, ...) for constant operands, lshiftI for\n");
+    printf("                             mult by a power of two\n");
+    printf("      --dce                  Remove dead computations and overwritten stores (reported with --stats)\n");
+    printf("      --frame                Address spill slots from a base in r0 with loadAI/storeAI\n");
     printf("  -s, --sched                Perform scheduler operations on the block\n");
     printf("  -k, --registers num        Number of registers to use for allocation (default 4)\n");
+    printf("      --sweep k1..k2         Allocate once for every k from k1 to k2 and print a summary\n");
+    printf("      --sweep-code           With --sweep, also print the allocated block for each k\n");
+    printf("  -j, --jobs num             Parse, print and sweep with num threads (default 1)\n");
+    printf("  -o, --output file          Write output to file instead of stdout\n");
     printf("  -d, --debug                Print debugging information\n");
     printf("  -h, --help                 Print this help message\n");
     printf("\nIf -a is enabled (default), outputs an equivalent block of ILOC code with registers 0 to k-1.\n");
 }
 
 // Function to process the file based on the specified flags
-void process_file(char *filename, int flag_lexer, int flag_pretty, int flag_table, int flag_alloc, int num_registers, int flag_debug, int flag_sched) {
-    // Open the file
-    FILE *file = fopen(filename, "r");
+void process_file(char *filename, const Options *options) {
+    // Open the file ("-" reads the block from stdin)
+    FILE *file = (strcmp(filename, "-") == 0) ? stdin : fopen(filename, "r");
     if (!file) {
         fprintf(stderr, "Error: Unable to open file %s\n", filename);
         exit(EXIT_FAILURE);
@@ -126,11 +269,11 @@ void process_file(char *filename, int flag_lexer, int flag_pretty, int flag_tabl
     IR ir;
     initIR(&ir);
 
-    if (flag_debug) {
+    if (options->debug) {
         debugLevel = 1;
     }
     
-    if (flag_lexer) {
+    if (options->lexer) {
         Token token;
         // Print all tokens one by one
         while ((token = getNextToken(&lexer)).cat != EOF_TOKEN) {
@@ -139,41 +282,79 @@ void process_file(char *filename, int flag_lexer, int flag_pretty, int flag_tabl
     } else {
         Parser parser;
         initParser(&parser, &lexer, &ir);
-        parseProgram(&parser);
+        parseProgramParallel(&parser, options->threads);
+        if (options->fold) {
+            foldConstants(&ir);
+        }
+        if (options->loads) {
+            eliminateLoads(&ir);  // Before value numbering, which then sees the forwarded values
+        }
+        if (options->lvn) {
+            numberValues(&ir);
+        }
+        if (options->select) {
+            selectImmediates(&ir);  // Once the constants are final
+        }
+        if (options->dce) {
+            // Last, so it also removes what the passes above left without readers
+            int deadCycles;
+            int dead = eliminateDeadCode(&ir, &deadCycles);
+            if (options->stats_format != STATS_NONE) {
+                printDeadCodeStats(dead, deadCycles, options->stats_format, stderr);
+            }
+        }
 
-        if (flag_sched) {
+        if (options->sched) {
             debug(1, "Initializing scheduling...");
             Allocator allocator;
-            initAllocator(&allocator, &ir, num_registers);
+            initAllocator(&allocator, &ir, options->registers);
             computeLastUse(&allocator);
             DependencyGraph *graph = createDependencyGraph(&ir);
             computeLatencies(graph);
             printDependencyGraph(graph);
             freeDependencyGraph(graph);
+            freeAllocator(&allocator);
         }
 
-        if (flag_alloc) {
+        if (options->alloc && options->sweep.first > 0) {
+            // One front end, one allocation per k
+            debug(1, "Sweeping k = %d..%d...", options->sweep.first, options->sweep.last);
+            runSweep(&ir, options->sweep, options->alloc_mode, options->budget, options->stats_format, options->threads, options->frame, stdout);
+        } else if (options->alloc) {
             // Run the allocator if -a flag is provided or defaulted
             Allocator allocator;
-            debug(1, "Initializing allocator with %d registers...", num_registers);
-            initAllocator(&allocator, &ir, num_registers);
+            debug(1, "Initializing allocator with %d registers...", options->registers);
+            initAllocator(&allocator, &ir, options->registers);
+            allocator.searchNodes = options->budget.nodes;
+            allocator.searchMillis = options->budget.millis;
+            allocator.frameSpills = options->frame;
             debug(1, "Computing last use...");
             computeLastUse(&allocator);
             debug(1, "Allocating registers...");
             //printf("Allocating registers...\n");
-            allocateRegisters(&allocator);
+            runAllocator(&allocator, options->alloc_mode);
             // debug(1, "Printing allocated IR.");
-            printAllocatedIR(&allocator);  // Print the IR after register allocation
+            emitIR(&allocator.finalIR, EMIT_PR, stdout, options->threads);  // Print the IR after register allocation
+            if (options->stats_format != STATS_NONE) {
+                AllocStats stats;
+                collectStats(&allocator, &stats);
+                printStats(&stats, options->stats_format, stderr);
+            }
+            freeAllocator(&allocator);
         } else {
-            if (flag_pretty) {
-                printIR(&ir, PRETTY_PRINT);
+            if (options->pretty) {
+                emitIR(&ir, EMIT_SR, stdout, options->threads);
             }
             
-            if (flag_table) {
+            if (options->table) {
                 printIR(&ir, TABLE_PRINT);
             }
         }
     }
 
-    fclose(file);
+    freeIR(&ir);
+    freeLexer(&lexer);
+    if (file != stdin) {
+        fclose(file);
+    }
 }
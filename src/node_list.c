@@ -2,9 +2,21 @@
 #include <stdlib.h>
 #include <stdio.h>
 
+static NodeList *allocNodeCell(Arena *arena) {
+    if (arena) {
+        return (NodeList *)arenaAlloc(arena, sizeof(NodeList));
+    }
+    return (NodeList *)malloc(sizeof(NodeList));
+}
+
 // Create a new NodeList
 NodeList *createNodeList() {
-    NodeList *list = (NodeList *)malloc(sizeof(NodeList));
+    return createNodeListIn(NULL);
+}
+
+// Create a new NodeList whose cells are owned by arena; such lists are never passed to freeNodeList
+NodeList *createNodeListIn(Arena *arena) {
+    NodeList *list = allocNodeCell(arena);
     if (!list) {
         fprintf(stderr, "Error: Failed to allocate memory for NodeList\n");
         exit(EXIT_FAILURE);
@@ -16,10 +28,14 @@ NodeList *createNodeList() {
 
 // Append a node to the list
 void appendNode(NodeList *list, void *data) {
+    appendNodeIn(NULL, list, data);
+}
+
+void appendNodeIn(Arena *arena, NodeList *list, void *data) {
     while (list->next) {
         list = list->next;
     }
-    NodeList *newNode = (NodeList *)malloc(sizeof(NodeList));
+    NodeList *newNode = allocNodeCell(arena);
     if (!newNode) {
         fprintf(stderr, "Error: Failed to allocate memory for NodeList node\n");
         exit(EXIT_FAILURE);
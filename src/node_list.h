@@ -1,6 +1,8 @@
 #ifndef NODE_LIST_H
 #define NODE_LIST_H
 
+#include "arena.h"
+
 // NodeList structure
 typedef struct NodeList {
     void *data;               // Generic pointer to data
@@ -9,7 +11,9 @@ typedef struct NodeList {
 
 // Function declarations
 NodeList *createNodeList();
+NodeList *createNodeListIn(Arena *arena);                   // Cells come from arena (NULL = malloc)
 void appendNode(NodeList *list, void *data);
+void appendNodeIn(Arena *arena, NodeList *list, void *data);
 void *removeNextNode(NodeList *list); // Return a generic pointer
 int isNodeListEmpty(NodeList *list);
 void freeNodeList(NodeList *list);
@@ -1,9 +1,54 @@
 #ifndef OPCODES_H
 #define OPCODES_H
 
+// Opcode table: enum name and the ILOC mnemonic for each instruction.
+// The lexer builds its scanner from this list, so a new opcode only needs an entry here.
+#define OPCODE_TABLE(X) \
+    X(LOADI,  "loadI")  \
+    X(LOAD,   "load")   \
+    X(STORE,  "store")  \
+    X(ADD,    "add")    \
+    X(SUB,    "sub")    \
+    X(MULT,   "mult")   \
+    X(LSHIFT, "lshift") \
+    X(RSHIFT, "rshift") \
+    X(OUTPUT, "output") \
+    X(NOP,    "nop")    \
+    X(ADDI,   "addI")   \
+    X(SUBI,   "subI")   \
+    X(MULTI,  "multI")  \
+    X(LSHIFTI, "lshiftI") \
+    X(RSHIFTI, "rshiftI") \
+    X(LOADAI, "loadAI") \
+    X(STOREAI, "storeAI")
+
 // Enum for instruction opcodes and other token values
 typedef enum {
-    LOADI, LOAD, STORE, ADD, SUB, MULT, LSHIFT, RSHIFT, OUTPUT, NOP
+#define X(name, text) name,
+    OPCODE_TABLE(X)
+#undef X
+    OPCODE_COUNT
 } OpcodeType;
 
+// The immediate forms (addI r1, c => r2) mirror ADD..RSHIFT in the same order, with the
+// constant in the instruction's immediate instead of src2
+static inline int isImmediateOp(int opcode) {
+    return opcode >= ADDI && opcode <= RSHIFTI;
+}
+
+// load and loadAI read the word at an address into dst; loadAI adds its immediate to src1
+static inline int isLoadOp(int opcode) {
+    return opcode == LOAD || opcode == LOADAI;
+}
+
+// store and storeAI write src1 to an address; storeAI adds its immediate to src2
+static inline int isStoreOp(int opcode) {
+    return opcode == STORE || opcode == STOREAI;
+}
+
+// Register form of an immediate opcode; other opcodes map to themselves
+static inline int registerForm(int opcode) {
+    return isImmediateOp(opcode) ? opcode - (ADDI - ADD) : opcode;
+}
+
 #endif // OPCODES_H
@@ -0,0 +1,496 @@
+#include "optimal.h"
+#include "utils.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include <time.h>
+
+#define MEMO_MAX_ENTRIES (1 << 22)   // Cap on remembered states
+#define MEMO_MAX_WORDS (1 << 24)     // Cap on the ints holding their register contents
+#define CLOCK_CHECK_INTERVAL 4096    // Nodes between time-budget checks
+
+typedef enum {
+    STEP_BRANCH,    // Stopped at a need with no free PR; a victim has to be chosen
+    STEP_LEAF,      // Reached the end of the block
+    STEP_PRUNED     // This partial solution cannot beat the best one
+} StepResult;
+
+// One logged state change
+typedef struct {
+    int *addr;
+    int old;
+} UndoEntry;
+
+// A need with several possible victims, and how far through them the search is
+typedef struct {
+    int mark;       // Undo log height at the need
+    int candStart;  // First candidate in cand[]
+    int candCount;  // Number of candidates
+    int next;       // Next candidate to try
+} Frame;
+
+// Instruction i has three needs: src1 (j = 0), src2 (j = 1) and dst (j = 2).
+// Registers are tracked as slots; slot s is PR s+1, PR0 stays reserved for spill addresses.
+typedef struct {
+    Allocator *allocator;
+    IR *ir;
+    const VRInfo *info;
+    int slots;
+
+    // Search state; every change goes through setState so it can be undone
+    int *slotVR;        // VR held by each slot, or -1
+    int *where;         // Slot holding each VR, or -1
+    int *stored;        // Whether the VR's current value is also in memory
+    int *nextUse;       // Next instruction reading each resident VR
+    int cost;           // Spill cycles so far
+    int owed;           // Reload cycles still owed by evicted values (a lower bound)
+    int i, j;           // Next need
+    int pendingVictim;  // Victim to use at the next full need, or -1
+
+    UndoEntry *log;
+    int logTop;
+    int logCap;
+
+    Frame *frames;
+    int depth;
+    int frameCap;
+    int *cand;
+    int candTop;
+    int candCap;
+    int *decision;      // Victim chosen at each need on the current path
+    int *bestDecision;
+    int bestCost;
+
+    uint64_t *memoKey;  // States seen at instruction starts, with the cheapest cost reaching them; 0 if empty
+    int *memoAt;        // Instruction of each state
+    int *memoState;     // Register contents of each state, slots ints per entry (see encodeState)
+    int *memoCost;
+    int *state;         // Scratch for the current state's contents
+    size_t memoMask;
+    size_t memoUsed;
+
+    SearchBudget budget;
+    long nodes;
+    struct timespec started;  // Monotonic wall clock, so other threads' work does not count
+    int exhausted;
+
+    int replay;         // Follow bestDecision and write finalIR instead of searching
+    int prs[3];
+} Search;
+
+static void *searchAlloc(Allocator *allocator, size_t count, size_t size) {
+    return arenaAlloc(&allocator->arena, (count > 0 ? count : 1) * size);
+}
+
+static void setState(Search *s, int *addr, int value) {
+    if (s->logTop == s->logCap) {
+        s->logCap = s->logCap ? s->logCap * 2 : 1024;
+        s->log = (UndoEntry *)realloc(s->log, s->logCap * sizeof(UndoEntry));
+        assertCondition(s->log != NULL, "Failed to grow search log");
+    }
+    s->log[s->logTop++] = (UndoEntry){addr, *addr};
+    *addr = value;
+}
+
+static void unwind(Search *s, int mark) {
+    while (s->logTop > mark) {
+        UndoEntry *entry = &s->log[--s->logTop];
+        *entry->addr = entry->old;
+    }
+}
+
+static int reloadCycles(const Search *s, int vr) {
+    if (s->info[vr].def == -1) {
+        return 0;  // Live on entry: takes a register at its first read and is never evicted
+    }
+    return restoreCycles(s->allocator, &s->info[vr]);
+}
+
+static uint64_t mix64(uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+// Writes the resident VRs with their stored bits as (vr << 1 | stored) codes, sorted and padded
+// with -1, so states that differ only in which slot holds which VR compare equal
+static void encodeState(const Search *s, int *state) {
+    int count = 0;
+    for (int slot = 0; slot < s->slots; slot++) {
+        int vr = s->slotVR[slot];
+        if (vr == -1) {
+            continue;
+        }
+        int code = vr << 1 | s->stored[vr];
+        int at = count++;
+        while (at > 0 && state[at - 1] > code) {
+            state[at] = state[at - 1];
+            at--;
+        }
+        state[at] = code;
+    }
+    while (count < s->slots) {
+        state[count++] = -1;
+    }
+}
+
+// Returns 1 if the state at this instruction start was already reached at no greater cost.
+// Entries are matched on their full contents, so a hash collision never prunes.
+static int memoPrune(Search *s) {
+    if (!s->memoKey) {
+        return 0;
+    }
+    size_t width = (size_t)s->slots;
+    encodeState(s, s->state);
+    uint64_t key = mix64((uint64_t)s->i + 1);
+    for (size_t slot = 0; slot < width; slot++) {
+        key = mix64(key ^ (uint64_t)(unsigned)s->state[slot]);
+    }
+    key |= 1;  // Zero marks an empty entry
+
+    size_t h = (size_t)key & s->memoMask;
+    while (s->memoKey[h] != 0) {
+        if (s->memoKey[h] == key && s->memoAt[h] == s->i &&
+            memcmp(&s->memoState[h * width], s->state, width * sizeof(int)) == 0) {
+            if (s->memoCost[h] <= s->cost) {
+                return 1;
+            }
+            s->memoCost[h] = s->cost;
+            return 0;
+        }
+        h = (h + 1) & s->memoMask;
+    }
+    if (s->memoUsed * 4 < (s->memoMask + 1) * 3) {
+        s->memoKey[h] = key;
+        s->memoAt[h] = s->i;
+        memcpy(&s->memoState[h * width], s->state, width * sizeof(int));
+        s->memoCost[h] = s->cost;
+        s->memoUsed++;
+    }
+    return 0;
+}
+
+// Frees a slot by evicting vr, storing it first if memory has no copy
+static int evict(Search *s, int vr) {
+    int slot = s->where[vr];
+    if (!s->stored[vr]) {
+        setState(s, &s->cost, s->cost + spillStoreCycles(s->allocator));
+        setState(s, &s->stored[vr], 1);
+        if (s->replay) {
+            emitSpillStore(s->allocator, vr, slot + 1);
+        }
+    }
+    setState(s, &s->owed, s->owed + reloadCycles(s, vr));
+    setState(s, &s->where[vr], -1);
+    setState(s, &s->slotVR[slot], -1);
+    return slot;
+}
+
+// A free slot, the pending victim's slot, or -1 if a victim must be chosen
+static int obtainSlot(Search *s) {
+    for (int slot = 0; slot < s->slots; slot++) {
+        if (s->slotVR[slot] == -1) {
+            return slot;
+        }
+    }
+    int victim = s->replay ? s->bestDecision[3 * s->i + s->j] : s->pendingVictim;
+    if (victim == -1) {
+        return -1;
+    }
+    s->pendingVictim = -1;
+    s->decision[3 * s->i + s->j] = victim;
+    return evict(s, victim);
+}
+
+static void place(Search *s, int vr, int slot, int nextUse) {
+    setState(s, &s->where[vr], slot);
+    setState(s, &s->slotVR[slot], vr);
+    setState(s, &s->nextUse[vr], nextUse);
+}
+
+static void release(Search *s, int vr) {
+    setState(s, &s->slotVR[s->where[vr]], -1);
+    setState(s, &s->where[vr], -1);
+}
+
+// Applies every forced step from the current need on, stopping at the next real choice
+static StepResult advance(Search *s) {
+    IR *ir = s->ir;
+    int resuming = (s->pendingVictim != -1);
+
+    for (;;) {
+        int i = s->i;
+        int j = s->j;
+        if (i == ir->count) {
+            return STEP_LEAF;
+        }
+        int srcs[2] = {ir->src1.vr[i], ir->src2.vr[i]};
+
+        if (j == 0 && !resuming) {
+            if (!s->replay && (s->cost + s->owed >= s->bestCost || memoPrune(s))) {
+                return STEP_PRUNED;
+            }
+        }
+        resuming = 0;
+
+        if (j < 2) {
+            int vr = srcs[j];
+            if (vr != -1 && !(j == 1 && vr == srcs[0]) && s->where[vr] == -1) {
+                int slot = obtainSlot(s);
+                if (slot == -1) {
+                    return STEP_BRANCH;
+                }
+                int cycles = reloadCycles(s, vr);
+                setState(s, &s->cost, s->cost + cycles);
+                setState(s, &s->owed, s->owed - cycles);
+                place(s, vr, slot, i);
+                if (s->replay && s->info[vr].def != -1) {
+                    emitRestore(s->allocator, s->info, vr, slot + 1);
+                }
+            }
+            if (vr != -1) {
+                s->prs[j] = s->where[vr] + 1;
+            }
+
+            if (j == 1) {
+                // Both sources are read; values dying here give their slots to the result
+                OperandColumns *ops[2] = {&ir->src1, &ir->src2};
+                for (int k = 0; k < 2; k++) {
+                    int v = srcs[k];
+                    if (v == -1 || (k == 1 && v == srcs[0])) {
+                        continue;
+                    }
+                    if (s->info[v].lastUse == i) {
+                        release(s, v);
+                        if (s->replay) {
+                            releaseSpillSlot(s->allocator, v);
+                        }
+                    } else {
+                        setState(s, &s->nextUse[v], ops[k]->nu[i]);
+                    }
+                }
+            }
+            setState(s, &s->j, j + 1);
+            continue;
+        }
+
+        int dst = ir->dst.vr[i];
+        if (dst != -1) {
+            int slot = obtainSlot(s);
+            if (slot == -1) {
+                return STEP_BRANCH;
+            }
+            place(s, dst, slot, ir->dst.nu[i]);
+            setState(s, &s->stored[dst], s->info[dst].cost != SPILL_DIRTY);
+            s->prs[2] = slot + 1;
+            if (s->info[dst].lastUse <= i) {
+                release(s, dst);  // Never read
+            }
+        }
+
+        if (s->replay) {
+            IRLine line = getIRLine(ir, i);
+            line.src1.pr = (srcs[0] != -1) ? s->prs[0] : 0;
+            line.src2.pr = (srcs[1] != -1) ? s->prs[1] : 0;
+            line.dst.pr = (dst != -1) ? s->prs[2] : 0;
+            addToIR(&s->allocator->finalIR, line);
+        }
+        setState(s, &s->i, i + 1);
+        setState(s, &s->j, 0);
+    }
+}
+
+// Opens a frame for the need the search stopped at, candidates ordered by GetPR's score
+static void pushFrame(Search *s) {
+    if (s->depth == s->frameCap) {
+        s->frameCap = s->frameCap ? s->frameCap * 2 : 256;
+        s->frames = (Frame *)realloc(s->frames, s->frameCap * sizeof(Frame));
+        assertCondition(s->frames != NULL, "Failed to grow search stack");
+    }
+    if (s->candTop + s->slots > s->candCap) {
+        s->candCap = (s->candCap ? s->candCap * 2 : 1024) + s->slots;
+        s->cand = (int *)realloc(s->cand, s->candCap * sizeof(int));
+        assertCondition(s->cand != NULL, "Failed to grow search stack");
+    }
+    Frame *frame = &s->frames[s->depth++];
+    frame->mark = s->logTop;
+    frame->candStart = s->candTop;
+    frame->next = 0;
+
+    // The instruction's sources stay put until both are read; the result may take either.
+    // Values live on entry have no copy in memory to come back from, so they are never evicted.
+    int src1 = s->ir->src1.vr[s->i];
+    int src2 = s->ir->src2.vr[s->i];
+    for (int slot = 0; slot < s->slots; slot++) {
+        int vr = s->slotVR[slot];
+        if (vr == -1 || (s->j < 2 && (vr == src1 || vr == src2)) || s->info[vr].def == -1) {
+            continue;
+        }
+        int score = (int)s->info[vr].cost - (s->nextUse[vr] - s->i);
+        int at = s->candTop++;
+        // Insertion sort: lowest score first, ties in slot order
+        while (at > frame->candStart) {
+            int prev = s->cand[at - 1];
+            int prevScore = (int)s->info[prev].cost - (s->nextUse[prev] - s->i);
+            if (prevScore <= score) {
+                break;
+            }
+            s->cand[at] = prev;
+            at--;
+        }
+        s->cand[at] = vr;
+    }
+    frame->candCount = s->candTop - frame->candStart;
+    if (frame->candCount == 0) {
+        printf("Error: %d registers cannot hold the values live at one instruction\n", s->slots + 1);
+        exit(EXIT_FAILURE);
+    }
+}
+
+static int budgetSpent(Search *s) {
+    if (s->bestCost == INT_MAX) {
+        return 0;  // Always finish the first (greedy) descent
+    }
+    if (s->nodes >= s->budget.nodes) {
+        return 1;
+    }
+    if (s->nodes % CLOCK_CHECK_INTERVAL == 0) {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        long elapsed = (long)(now.tv_sec - s->started.tv_sec) * 1000 +
+                       (now.tv_nsec - s->started.tv_nsec) / 1000000;
+        return elapsed >= s->budget.millis;
+    }
+    return 0;
+}
+
+static void resetState(Search *s) {
+    int vrCount = s->allocator->vrCount;
+    for (int slot = 0; slot < s->slots; slot++) {
+        s->slotVR[slot] = -1;
+    }
+    for (int v = 0; v < vrCount; v++) {
+        s->where[v] = -1;
+        s->stored[v] = 1;
+        s->nextUse[v] = INT_MAX;
+    }
+    s->cost = 0;
+    s->owed = 0;
+    s->i = 0;
+    s->j = 0;
+    s->pendingVictim = -1;
+    s->logTop = 0;
+}
+
+// Cycles the bottom-up allocator spends on the same block
+static int heuristicCycles(Allocator *allocator) {
+    Allocator heuristic;
+    initAllocator(&heuristic, allocator->ir, allocator->k);
+    copyLastUse(&heuristic, allocator);
+    heuristic.frameSpills = allocator->frameSpills;
+    allocateRegisters(&heuristic);
+    int cycles = heuristic.spillCycles;
+    freeAllocator(&heuristic);
+    return cycles;
+}
+
+void allocateRegistersOptimal(Allocator *allocator, SearchBudget budget) {
+    IR *ir = allocator->ir;
+    if (allocator->k < 3) {
+        printf("Error: Optimal allocation needs at least 3 registers\n");
+        exit(EXIT_FAILURE);
+    }
+    int heuristic = (debugLevel >= 1) ? heuristicCycles(allocator) : 0;  // Only reported when debugging
+
+    Search s;
+    memset(&s, 0, sizeof(s));
+    s.allocator = allocator;
+    s.ir = ir;
+    s.info = computeVRInfo(allocator);
+    s.slots = allocator->k - 1;
+    s.budget = budget;
+    s.slotVR = (int *)searchAlloc(allocator, s.slots, sizeof(int));
+    s.where = (int *)searchAlloc(allocator, allocator->vrCount, sizeof(int));
+    s.stored = (int *)searchAlloc(allocator, allocator->vrCount, sizeof(int));
+    s.nextUse = (int *)searchAlloc(allocator, allocator->vrCount, sizeof(int));
+    s.decision = (int *)searchAlloc(allocator, 3 * (size_t)ir->count, sizeof(int));
+    s.bestDecision = (int *)searchAlloc(allocator, 3 * (size_t)ir->count, sizeof(int));
+    s.state = (int *)searchAlloc(allocator, s.slots, sizeof(int));
+
+    size_t memoEntries = 1024;
+    while (memoEntries < MEMO_MAX_ENTRIES && (long)memoEntries < budget.nodes * 2 &&
+           memoEntries * 2 * s.slots <= MEMO_MAX_WORDS) {
+        memoEntries *= 2;
+    }
+    s.memoKey = (uint64_t *)calloc(memoEntries, sizeof(uint64_t));
+    s.memoAt = (int *)malloc(memoEntries * sizeof(int));
+    s.memoState = (int *)malloc(memoEntries * s.slots * sizeof(int));
+    s.memoCost = (int *)malloc(memoEntries * sizeof(int));
+    s.memoMask = memoEntries - 1;
+    if (!s.memoKey || !s.memoAt || !s.memoState || !s.memoCost) {
+        free(s.memoKey);
+        free(s.memoAt);
+        free(s.memoState);
+        free(s.memoCost);
+        s.memoKey = NULL;  // Search without state pruning
+        s.memoAt = NULL;
+        s.memoState = NULL;
+        s.memoCost = NULL;
+    }
+
+    // Depth-first branch-and-bound; the first descent takes GetPR's choice everywhere
+    resetState(&s);
+    s.bestCost = INT_MAX;
+    clock_gettime(CLOCK_MONOTONIC, &s.started);
+    StepResult result = advance(&s);
+    for (;;) {
+        if (result == STEP_LEAF && s.cost < s.bestCost) {
+            s.bestCost = s.cost;
+            memcpy(s.bestDecision, s.decision, 3 * (size_t)ir->count * sizeof(int));
+        } else if (result == STEP_BRANCH) {
+            pushFrame(&s);
+        }
+
+        while (s.depth > 0 && s.frames[s.depth - 1].next == s.frames[s.depth - 1].candCount) {
+            Frame *done = &s.frames[--s.depth];
+            unwind(&s, done->mark);
+            s.candTop = done->candStart;
+        }
+        if (s.depth == 0) {
+            break;
+        }
+        if (budgetSpent(&s)) {
+            s.exhausted = 1;
+            break;
+        }
+
+        Frame *frame = &s.frames[s.depth - 1];
+        unwind(&s, frame->mark);
+        s.pendingVictim = s.cand[frame->candStart + frame->next++];
+        s.nodes++;
+        result = advance(&s);
+    }
+
+    // Replay the best decisions, this time writing the code
+    resetState(&s);
+    s.replay = 1;
+    advance(&s);
+
+    if (debugLevel >= 1) {
+        debug(1, "optimal allocation: %d spill cycles (%s after %ld nodes), heuristic: %d cycles, gap: %d cycles",
+              s.bestCost, s.exhausted ? "budget exhausted" : "proven", s.nodes, heuristic, heuristic - s.bestCost);
+    }
+
+    free(s.log);
+    free(s.frames);
+    free(s.cand);
+    free(s.memoKey);
+    free(s.memoAt);
+    free(s.memoState);
+    free(s.memoCost);
+}
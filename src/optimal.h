@@ -0,0 +1,26 @@
+#ifndef OPTIMAL_H
+#define OPTIMAL_H
+
+#include "allocator.h"
+
+#define OPT_DEFAULT_NODES 2000000L  // Search nodes explored before settling for the best so far
+#define OPT_DEFAULT_MILLIS 5000L    // Wall-clock limit for the search
+
+// Limits for the exact search; whichever runs out first ends it
+typedef struct SearchBudget {
+    long nodes;     // Victim choices to try
+    long millis;    // Milliseconds to spend
+} SearchBudget;
+
+/**
+ * Finds the spill and restore code with the fewest cycles by branch-and-bound over every
+ * choice of which value gives up its register, with the cost model of the local allocator
+ * (rematerialization, clean reloads, one store per dirty value). States already reached more
+ * cheaply are pruned, and so is any partial solution whose cost plus the reloads still owed
+ * cannot beat the best found. When the budget runs out the best allocation found so far is used.
+ * Values live on entry are never evicted. With -d, reports the result next to the heuristic
+ * allocator's as a debug comment. The result is left in finalIR.
+ */
+void allocateRegistersOptimal(Allocator *allocator, SearchBudget budget);
+
+#endif
@@ -1,6 +1,11 @@
 #include "parser.h"
 #include "utils.h"
+#include "scan.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#define PARSE_MIN_CHUNK_BYTES (256 * 1024)  // Smallest slice worth handing to its own thread
 
 void initParser(Parser *parser, Lexer *lexer, IR *ir) {
     parser->lexer = lexer;
@@ -17,6 +22,86 @@ void parseProgram(Parser *parser) {
     }
 }
 
+// One newline-aligned slice of the input and the IR segment parsed from it
+typedef struct {
+    const char *start;
+    const char *end;
+    IR ir;
+} ParseChunk;
+
+static void *parseChunk(void *arg) {
+    ParseChunk *chunk = (ParseChunk *)arg;
+    Lexer lexer;
+    Parser parser;
+    initLexerFromBuffer(&lexer, chunk->start, (size_t)(chunk->end - chunk->start));
+    initParser(&parser, &lexer, &chunk->ir);
+    parseProgram(&parser);
+    return NULL;
+}
+
+void parseProgramParallel(Parser *parser, int threads) {
+    Lexer *lexer = parser->lexer;
+    // Streams cannot be split, and a block that ends mid-buffer is already partly consumed
+    if (threads <= 1 || !lexer->cursor || lexer->currentChar == EOF) {
+        parseProgram(parser);
+        return;
+    }
+
+    const char *start = lexer->cursor - 1;  // currentChar has not been scanned yet
+    const char *end = lexer->end;
+    size_t length = (size_t)(end - start);
+    if ((size_t)threads > length / PARSE_MIN_CHUNK_BYTES) {
+        threads = (int)(length / PARSE_MIN_CHUNK_BYTES);
+    }
+    if (threads <= 1) {
+        parseProgram(parser);
+        return;
+    }
+
+    ParseChunk *chunks = (ParseChunk *)malloc(threads * sizeof(ParseChunk));
+    pthread_t *workers = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    assertCondition(chunks != NULL && workers != NULL, "Failed to allocate parser chunks");
+
+    // Cut at the first newline after each even split point so no instruction straddles two chunks
+    const char *chunkStart = start;
+    for (int i = 0; i < threads; i++) {
+        const char *chunkEnd = end;
+        if (i < threads - 1) {
+            const char *split = start + length / threads * (i + 1);
+            if (split < chunkStart) {
+                split = chunkStart;
+            }
+            const char *newline = findNewline(split, end);
+            chunkEnd = (newline < end) ? newline + 1 : end;
+        }
+        chunks[i].start = chunkStart;
+        chunks[i].end = chunkEnd;
+        initIR(&chunks[i].ir);
+        chunkStart = chunkEnd;
+    }
+
+    for (int i = 0; i < threads; i++) {
+        if (pthread_create(&workers[i], NULL, parseChunk, &chunks[i]) != 0) {
+            error("Failed to start parser thread");
+        }
+    }
+    for (int i = 0; i < threads; i++) {
+        pthread_join(workers[i], NULL);
+    }
+
+    // Splice the segments back in input order
+    for (int i = 0; i < threads; i++) {
+        appendIR(parser->ir, &chunks[i].ir);
+    }
+
+    // The whole buffer has been consumed
+    lexer->cursor = end;
+    lexer->currentChar = EOF;
+
+    free(workers);
+    free(chunks);
+}
+
 IRLine parseInstruction(Parser *parser, OpcodeType opcode) {
     switch (opcode) {
         case LOADI:
@@ -31,6 +116,15 @@ IRLine parseInstruction(Parser *parser, OpcodeType opcode) {
         case RSHIFT:
         case LSHIFT:
             return parseShiftOp(parser, opcode);
+        case ADDI:
+        case SUBI:
+        case MULTI:
+        case LSHIFTI:
+        case RSHIFTI:
+        case LOADAI:
+            return parseImmediateOp(parser, opcode);  // loadAI rBase, offset => rDst has the same shape
+        case STOREAI:
+            return parseStoreAI(parser);
         case OUTPUT:
             return parseOutput(parser);
         case NOP:
@@ -154,6 +248,55 @@ IRLine parseShiftOp(Parser *parser, OpcodeType opcode) {
     return line;
 }
 
+IRLine parseImmediateOp(Parser *parser, OpcodeType opcode) {
+    IRLine line;
+    initIRLine(&line);
+    line.opcode = opcode;
+
+    Token tok = getNextToken(parser->lexer);
+    if (tok.cat == REGISTER) {
+        line.src1.sr = tok.val;
+    }
+
+    tok = getNextToken(parser->lexer);
+    if (tok.cat == COMMA) {
+        tok = getNextToken(parser->lexer);
+        if (tok.cat == CONSTANT) {
+            line.src1.imm = tok.val;  // The IR keeps one immediate per instruction, in src1
+        } else {
+            printf("Expected CONSTANT, but got token category: %d\n", tok.cat);
+        }
+    }
+
+    tok = getNextToken(parser->lexer);
+    if (tok.cat == ARROW) {
+        tok = getNextToken(parser->lexer);
+        if (tok.cat == REGISTER) {
+            line.dst.sr = tok.val;
+        }
+    }
+    return line;
+}
+
+IRLine parseStoreAI(Parser *parser) {
+    IRLine line;
+    initIRLine(&line);
+    line.opcode = STOREAI;
+
+    Token tok = getNextToken(parser->lexer);
+    assertCondition(tok.cat == REGISTER, "Non register type found for src1 in storeAI");
+    line.src1.sr = tok.val;
+    assertCondition(getNextToken(parser->lexer).cat == ARROW, "Non arrow type found after src1 in storeAI");
+    tok = getNextToken(parser->lexer);
+    assertCondition(tok.cat == REGISTER, "Non register type found for the base in storeAI");
+    line.src2.sr = tok.val;
+    assertCondition(getNextToken(parser->lexer).cat == COMMA, "Non comma type found after the base in storeAI");
+    tok = getNextToken(parser->lexer);
+    assertCondition(tok.cat == CONSTANT, "Non constant type found for the offset in storeAI");
+    line.src1.imm = tok.val;
+    return line;
+}
+
 IRLine parseOutput(Parser *parser) {
     IRLine line;
     initIRLine(&line);
@@ -169,6 +312,7 @@ IRLine parseOutput(Parser *parser) {
 
 IRLine parseNop() {
     IRLine line;
+    initIRLine(&line);
     line.opcode = NOP;
     return line;
 }
@@ -2,7 +2,7 @@
 #define PARSER_H
 
 #include "lexer.h"
-#include "ir.h"
+#include "IR.h"
 
 typedef struct {
     Lexer *lexer;
@@ -12,12 +12,15 @@ typedef struct {
 
 void initParser(Parser *parser, Lexer *lexer, IR *ir);
 void parseProgram(Parser *parser);
+void parseProgramParallel(Parser *parser, int threads);
 
 IRLine parseInstruction(Parser *parser, OpcodeType opcode);
 IRLine parseLoadI(Parser *parser);
 IRLine parseMemOp(Parser *parser, OpcodeType opcode);
 IRLine parseArithOp(Parser *parser, OpcodeType opcode);
 IRLine parseShiftOp(Parser *parser, OpcodeType opcode);
+IRLine parseImmediateOp(Parser *parser, OpcodeType opcode);
+IRLine parseStoreAI(Parser *parser);
 IRLine parseOutput(Parser *parser);
 IRLine parseNop();
 
@@ -0,0 +1,127 @@
+#include "scan.h"
+#include <stdint.h>
+#include <string.h>
+
+// Kernels step a 64-bit word at a time on little-endian targets, where the lowest set byte of a
+// mask is the first byte in memory; elsewhere, or with SCAN_NO_SWAR, they fall back to byte loops
+#if !defined(SCAN_NO_SWAR) && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define SCAN_SWAR 1
+#else
+#define SCAN_SWAR 0
+#endif
+
+#define ONES 0x0101010101010101ULL
+#define HIGHS 0x8080808080808080ULL
+#define LOWS 0x7F7F7F7F7F7F7F7FULL
+
+static inline int isWhitespaceByte(unsigned char c) {
+    return c == ' ' || (unsigned char)(c - '\t') <= ('\r' - '\t');
+}
+
+static inline int isDigitByte(unsigned char c) {
+    return (unsigned char)(c - '0') <= 9;
+}
+
+#if SCAN_SWAR
+static inline uint64_t loadWord(const char *p) {
+    uint64_t x;
+    memcpy(&x, p, sizeof(x));
+    return x;
+}
+
+// The high bit of each byte of the result is set when that byte of x equals c. Exact per byte:
+// no sum below carries into the next byte.
+static inline uint64_t bytesEqual(uint64_t x, unsigned char c) {
+    uint64_t y = x ^ (ONES * c);
+    return ~(((y & LOWS) + LOWS) | y) & HIGHS;
+}
+
+// Likewise for bytes of x in [lo, hi], with hi < 0x80
+static inline uint64_t bytesInRange(uint64_t x, unsigned char lo, unsigned char hi) {
+    uint64_t atLeastLo = (x & LOWS) + ONES * (0x80 - lo);
+    uint64_t aboveHi = (x & LOWS) + ONES * (0x7F - hi);
+    return atLeastLo & ~aboveHi & ~x & HIGHS;
+}
+
+static inline uint64_t whitespaceMask(uint64_t x) {
+    return bytesEqual(x, ' ') | bytesInRange(x, '\t', '\r');
+}
+
+// Index of the first byte flagged in a nonzero mask
+static inline int firstByte(uint64_t mask) {
+    return __builtin_ctzll(mask) >> 3;
+}
+#endif
+
+const char *skipWhitespaceRun(const char *p, const char *end) {
+    // Most runs between tokens are a single space, so check a couple of bytes before going wide
+    if (p >= end || !isWhitespaceByte((unsigned char)*p)) return p;
+    if (++p < end && !isWhitespaceByte((unsigned char)*p)) return p;
+#if SCAN_SWAR
+    while (end - p >= 8) {
+        uint64_t stop = ~whitespaceMask(loadWord(p)) & HIGHS;
+        if (stop) {
+            return p + firstByte(stop);
+        }
+        p += 8;
+    }
+#endif
+    while (p < end && isWhitespaceByte((unsigned char)*p)) p++;
+    return p;
+}
+
+const char *findNewline(const char *p, const char *end) {
+#if SCAN_SWAR
+    while (end - p >= 8) {
+        uint64_t newline = bytesEqual(loadWord(p), '\n');
+        if (newline) {
+            return p + firstByte(newline);
+        }
+        p += 8;
+    }
+#endif
+    while (p < end && *p != '\n') p++;
+    return p;
+}
+
+// Converts 8 ASCII digits (first digit in the lowest byte) to their value with SWAR multiplies
+static inline uint32_t parseEightDigits(const char *p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    v = ((v & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+    v = ((v & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+    return (uint32_t)(((v & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32);
+}
+
+// Returns the position just past the run of digits starting at p
+static inline const char *digitRunEnd(const char *p, const char *end) {
+#if SCAN_SWAR
+    while (end - p >= 8) {
+        uint64_t stop = ~bytesInRange(loadWord(p), '0', '9') & HIGHS;
+        if (stop) {
+            return p + firstByte(stop);
+        }
+        p += 8;
+    }
+#endif
+    while (p < end && isDigitByte((unsigned char)*p)) p++;
+    return p;
+}
+
+const char *parseDigitRun(const char *p, const char *end, int *value) {
+    const char *runEnd = digitRunEnd(p, end);
+
+    // Fold the run eight digits at a time; unsigned math wraps the same way the byte loop does
+    unsigned int number = 0;
+#if SCAN_SWAR
+    while (runEnd - p >= 8) {
+        number = number * 100000000u + parseEightDigits(p);
+        p += 8;
+    }
+#endif
+    while (p < runEnd) {
+        number = number * 10u + (unsigned int)(*p++ - '0');
+    }
+    *value = (int)number;
+    return runEnd;
+}
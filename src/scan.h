@@ -0,0 +1,27 @@
+#ifndef SCAN_H
+#define SCAN_H
+
+#include <stddef.h>
+
+// Bulk scanning kernels used by the lexer when it runs over an in-memory buffer.
+// Each kernel tests eight bytes per step with portable 64-bit word arithmetic (SWAR) on
+// little-endian targets and uses a byte loop otherwise. None of them read past end. Define
+// SCAN_NO_SWAR to force the byte loops.
+
+/**
+ * Returns the first position at or after p that is not a whitespace byte (isspace in the C locale).
+ */
+const char *skipWhitespaceRun(const char *p, const char *end);
+
+/**
+ * Returns the position of the first '\n' at or after p, or end if there is none.
+ */
+const char *findNewline(const char *p, const char *end);
+
+/**
+ * Parses the run of decimal digits starting at p into *value (wrapping like the byte loop)
+ * and returns the position just past the run.
+ */
+const char *parseDigitRun(const char *p, const char *end, int *value);
+
+#endif
@@ -1,4 +1,5 @@
 #include "scheduler.h"
+#include "alias.h"
 #include "utils.h"
 #include <stdio.h>
 #include <stdlib.h>
@@ -7,14 +8,90 @@ int getLatency(int opcode) {
     switch (opcode) {
         case LOAD:
         case STORE:
+        case LOADAI:
+        case STOREAI:
             return 3;
         case MULT:
+        case MULTI:
             return 2;
         default:
             return 1;
     }
 }
 
+// Adds an edge from node to the node with the given label, unless there is none or it exists
+static void addDependence(DependencyGraph *graph, GraphNode *node, int label) {
+    if (label != -1 && !nodeExistsInList(node->dependencies, graph->nodes[label - 1])) {
+        appendNodeIn(&graph->arena, node->dependencies, graph->nodes[label - 1]);
+    }
+}
+
+// Memory operations since the last store to an unknown address, which orders everything before it
+typedef struct MemoryState {
+    int lastUnknownStore;   // Label of the last store to an unknown address, or -1
+    AddressMap lastStoreAt; // Label of the last store to each known address
+    AddressMap readsAt;     // Newest read of each known address since its last store
+    int *previousRead;      // Older read of the same address, by label
+    int *knownStores;       // Labels of stores to known addresses
+    int knownStoreCount;
+    int *reads;             // Labels of loads and outputs
+    int readCount;
+    int *unknownReads;      // Labels of loads from unknown addresses
+    int unknownReadCount;
+} MemoryState;
+
+// A read of address depends on the stores that may have written it
+static void addReadDependences(DependencyGraph *graph, MemoryState *memory, GraphNode *node, int address) {
+    addDependence(graph, node, memory->lastUnknownStore);
+    if (address == ADDRESS_UNKNOWN) {
+        for (int j = 0; j < memory->knownStoreCount; j++) {
+            addDependence(graph, node, memory->knownStores[j]);
+        }
+        memory->unknownReads[memory->unknownReadCount++] = node->label;
+    } else {
+        for (int a = address - (WORD_BYTES - 1); a <= address + (WORD_BYTES - 1); a++) {
+            addDependence(graph, node, addressValue(&memory->lastStoreAt, a));
+        }
+        int *newest = addressEntry(&memory->readsAt, address);
+        memory->previousRead[node->label] = *newest;
+        *newest = node->label;
+    }
+    memory->reads[memory->readCount++] = node->label;
+}
+
+// A store depends on every earlier access it may overlap
+static void addStoreDependences(DependencyGraph *graph, MemoryState *memory, GraphNode *node, int address) {
+    addDependence(graph, node, memory->lastUnknownStore);
+    if (address == ADDRESS_UNKNOWN) {
+        for (int j = 0; j < memory->knownStoreCount; j++) {
+            addDependence(graph, node, memory->knownStores[j]);
+        }
+        for (int j = 0; j < memory->readCount; j++) {
+            addDependence(graph, node, memory->reads[j]);
+        }
+        memory->lastUnknownStore = node->label;
+        memory->knownStoreCount = 0;
+        memory->readCount = 0;
+        memory->unknownReadCount = 0;
+        return;
+    }
+    for (int j = 0; j < memory->unknownReadCount; j++) {
+        addDependence(graph, node, memory->unknownReads[j]);
+    }
+    for (int a = address - (WORD_BYTES - 1); a <= address + (WORD_BYTES - 1); a++) {
+        addDependence(graph, node, addressValue(&memory->lastStoreAt, a));
+        // Reads before the last unknown store are already ordered by it
+        int read = addressValue(&memory->readsAt, a);
+        for (; read > memory->lastUnknownStore; read = memory->previousRead[read]) {
+            addDependence(graph, node, read);
+        }
+    }
+    // Later accesses to this address reach the older ones through this store
+    *addressEntry(&memory->lastStoreAt, address) = node->label;
+    *addressEntry(&memory->readsAt, address) = -1;
+    memory->knownStores[memory->knownStoreCount++] = node->label;
+}
+
 DependencyGraph *createDependencyGraph(IR *ir) {
     printIR(ir, PRETTY_PRINT);
     debug(1, "Creating dependency graph");
@@ -23,34 +100,47 @@ DependencyGraph *createDependencyGraph(IR *ir) {
     debug(1, "Maximum VR index: %d", maxSR);
 
     int *VRtoNode = (int *)malloc((maxSR + 1) * sizeof(int));
-    int *lastStoreMap = (int *)malloc((maxSR + 1) * sizeof(int));
     for (int i = 0; i <= maxSR; i++) {
         VRtoNode[i] = -1; 
-        lastStoreMap[i] = -1;
     }
 
+    // Memory edges are only drawn between accesses that may touch the same word
+    int *address = (int *)malloc((ir->count + 1) * sizeof(int));
+    MemoryState memory = {.lastUnknownStore = -1};
+    initAddressMap(&memory.lastStoreAt, ir->count);
+    initAddressMap(&memory.readsAt, ir->count);
+    memory.previousRead = (int *)malloc((ir->count + 1) * sizeof(int));
+    memory.knownStores = (int *)malloc((ir->count + 1) * sizeof(int));
+    memory.reads = (int *)malloc((ir->count + 1) * sizeof(int));
+    memory.unknownReads = (int *)malloc((ir->count + 1) * sizeof(int));
+    assertCondition(VRtoNode && address && memory.previousRead && memory.knownStores && memory.reads && memory.unknownReads,
+                    "Failed to allocate dependence tables");
+    computeAddresses(ir, address);
+
     // Allocate the dependency graph
     DependencyGraph *graph = (DependencyGraph *)malloc(sizeof(DependencyGraph));
     graph->nodes = (GraphNode **)malloc(ir->count * sizeof(GraphNode *));
     graph->nodeCount = ir->count;
+    graph->ir = ir;
+    initArena(&graph->arena, 0);  // Nodes and edges are released together in freeDependencyGraph
 
-    // Track last STORE and OUTPUT nodes
-    int lastStore = -1;
+    // Outputs stay in program order
     int lastOutput = -1;
 
-    List *current = ir->instructions->next;
-    NodeList *trackedLoads = createNodeList();
     int nodeIndex = 0;
 
-    while (current) {
-        IRLine *line = current->head;
-        GraphNode *node = (GraphNode *)malloc(sizeof(GraphNode));
+    for (int i = 0; i < ir->count; i++) {
+        GraphNode *node = (GraphNode *)arenaAlloc(&graph->arena, sizeof(GraphNode));
         
 
         node->label = nodeIndex + 1;
-        node->instruction = line;
-        node->dependencies = createNodeList();
-        node->parents = createNodeList();
+        IRLine current = getIRLine(ir, i);
+        IRLine *line = &current;
+        node->instruction = i;
+        node->opcode = line->opcode;
+        node->weight = 0;
+        node->dependencies = createNodeListIn(&graph->arena);
+        node->parents = createNodeListIn(&graph->arena);
 
         switch (line->opcode) {
             case LOADI:
@@ -58,59 +148,31 @@ DependencyGraph *createDependencyGraph(IR *ir) {
                 break;
 
             case LOAD:
+            case LOADAI:
                 if (line->src1.vr != -1 && VRtoNode[line->src1.vr] != -1) {
-                    appendNode(node->dependencies, graph->nodes[VRtoNode[line->src1.vr] - 1]);
-                }
-                if (lastStore != -1) {
-                    appendNode(node->dependencies, graph->nodes[lastStore - 1]);
+                    appendNodeIn(&graph->arena, node->dependencies, graph->nodes[VRtoNode[line->src1.vr] - 1]);
                 }
+                addReadDependences(graph, &memory, node, address[i]);
                 VRtoNode[line->dst.vr] = node->label;
-
-                appendNode(trackedLoads, node); // Track current load
                 break;
 
             case STORE:
+            case STOREAI:
                 if (line->src1.vr != -1 && VRtoNode[line->src1.vr] != -1) {
-                    appendNode(node->dependencies, graph->nodes[VRtoNode[line->src1.vr] - 1]);
+                    appendNodeIn(&graph->arena, node->dependencies, graph->nodes[VRtoNode[line->src1.vr] - 1]);
                 }
                 if (line->src2.vr != -1 && VRtoNode[line->src2.vr] != -1) {
-                    appendNode(node->dependencies, graph->nodes[VRtoNode[line->src2.vr] - 1]);
-                }
-                if (lastStore != -1) {
-                    if (!nodeExistsInList(node->dependencies, graph->nodes[lastStore - 1])) {
-                        appendNode(node->dependencies, graph->nodes[lastStore - 1]);
-                    }
-                }
-                if (lastOutput != -1) {
-                    if (!nodeExistsInList(node->dependencies, graph->nodes[lastOutput - 1])) {
-                        appendNode(node->dependencies, graph->nodes[lastOutput - 1]);
-                    }
+                    appendNodeIn(&graph->arena, node->dependencies, graph->nodes[VRtoNode[line->src2.vr] - 1]);
                 }
-
-                // Add dependencies on tracked loads
-                NodeList *loadList = trackedLoads->next;
-                while (loadList) {
-                    GraphNode *loadNode = (GraphNode *)loadList->data;
-                    if (!nodeExistsInList(node->dependencies, loadNode)) {
-                        appendNode(node->dependencies, loadNode);
-                    }
-                    loadList = loadList->next;
-                }
-                freeNodeList(trackedLoads);
-                trackedLoads = createNodeList();
+                addStoreDependences(graph, &memory, node, address[i]);
 
                 VRtoNode[line->src2.vr] = node->label;
-                lastStore = node->label;
                 break;
 
 
             case OUTPUT:
-                if (lastOutput != -1) {
-                    appendNode(node->dependencies, graph->nodes[lastOutput - 1]);
-                }
-                if (lastStore != -1) {
-                    appendNode(node->dependencies, graph->nodes[lastStore - 1]);
-                }
+                addDependence(graph, node, lastOutput);
+                addReadDependences(graph, &memory, node, address[i]);
                 lastOutput = node->label;
                 break;
 
@@ -119,21 +181,26 @@ DependencyGraph *createDependencyGraph(IR *ir) {
 
             default:
                 if (line->src1.vr != -1 && VRtoNode[line->src1.vr] != -1) {
-                    appendNode(node->dependencies, graph->nodes[VRtoNode[line->src1.vr] - 1]);
+                    appendNodeIn(&graph->arena, node->dependencies, graph->nodes[VRtoNode[line->src1.vr] - 1]);
                 }
                 if (line->src2.vr != -1 && VRtoNode[line->src2.vr] != -1) {
-                    appendNode(node->dependencies, graph->nodes[VRtoNode[line->src2.vr] - 1]);
+                    appendNodeIn(&graph->arena, node->dependencies, graph->nodes[VRtoNode[line->src2.vr] - 1]);
                 }
                 VRtoNode[line->dst.vr] = node->label;
                 break;
         }
 
         graph->nodes[nodeIndex++] = node;
-        current = current->next;
     }
 
-    freeNodeList(trackedLoads);
     free(VRtoNode);
+    free(address);
+    freeAddressMap(&memory.lastStoreAt);
+    freeAddressMap(&memory.readsAt);
+    free(memory.previousRead);
+    free(memory.knownStores);
+    free(memory.reads);
+    free(memory.unknownReads);
     return graph;
 }
 
@@ -166,7 +233,7 @@ int calcWeights(GraphNode *node) {
         parents = parents->next;
     }
 
-    node->weight = getLatency(node->instruction->opcode) + maxWeight;
+    node->weight = getLatency(node->opcode) + maxWeight;
     return node->weight;
 }
 
@@ -177,7 +244,7 @@ void computeLatencies(DependencyGraph *graph) {
 
         while (deps) {
             GraphNode *dep = (GraphNode *)deps->data;
-            appendNode(dep->parents, (void *)node);
+            appendNodeIn(&graph->arena, dep->parents, (void *)node);
             deps = deps->next;
         }
     }
@@ -191,8 +258,9 @@ void printDependencyGraph(DependencyGraph *graph) {
     printf("nodes:\n");
     for (int i = 0; i < graph->nodeCount; i++) {
         GraphNode *node = graph->nodes[i];
+        IRLine line = getIRLine(graph->ir, node->instruction);
         printf("    n%d : ", node->label);
-        prettyPrintInstructionVRs(node->instruction);
+        prettyPrintInstructionVRs(&line);
     }
 
     printf("\nedges:\n");
@@ -219,12 +287,7 @@ void printDependencyGraph(DependencyGraph *graph) {
 }
 
 void freeDependencyGraph(DependencyGraph *graph) {
-    for (int i = 0; i < graph->nodeCount; i++) {
-        GraphNode *node = graph->nodes[i];
-        freeNodeList(node->dependencies);
-        freeNodeList(node->parents);
-        free(node);
-    }
+    freeArena(&graph->arena);  // Every node and edge list lives in the arena
     free(graph->nodes);
     free(graph);
 }
@@ -7,7 +7,8 @@
 // Graph node structure
 typedef struct GraphNode {
     int label;                  // Node label
-    IRLine *instruction;        // Associated instruction
+    int instruction;            // Index of the associated instruction in the graph's IR
+    int opcode;                 // Opcode of that instruction
     NodeList *dependencies;     // List of dependencies (edges)
     NodeList *parents;          // List of parent nodes (reverse edges)
     int weight;                 // Node weight for scheduling
@@ -17,9 +18,12 @@ typedef struct GraphNode {
 typedef struct DependencyGraph {
     GraphNode **nodes;          // Array of graph nodes
     int nodeCount;              // Number of nodes
+    IR *ir;                     // IR the nodes index into
+    Arena arena;                // Storage for nodes and edge lists
 } DependencyGraph;
 
 // Function declarations
+int getLatency(int opcode);
 DependencyGraph *createDependencyGraph(IR *ir);
 void computeLatencies(DependencyGraph *graph);
 void printDependencyGraph(DependencyGraph *graph);
@@ -0,0 +1,51 @@
+#include "select.h"
+#include "fold.h"
+#include "opcodes.h"
+#include "utils.h"
+
+int selectImmediates(IR *ir) {
+    ConstantTable constants;
+    initConstantTable(&constants, ir);
+
+    int selected = 0;
+    int reduced = 0;
+    for (int i = 0; i < ir->count; i++) {
+        int op = ir->opcode[i];
+        int src1 = ir->src1.sr[i];
+        int src2 = ir->src2.sr[i];
+        if (op >= ADD && op <= RSHIFT && (constants.known[src1] || constants.known[src2])) {
+            if ((op == ADD || op == MULT) && !constants.known[src2]) {
+                ir->src1.sr[i] = src2;  // Commutative, so the constant can move to the second slot
+                ir->src2.sr[i] = src1;
+                src2 = src1;
+            }
+            if (constants.known[src2]) {
+                int constant = constants.value[src2];
+                if (op == MULT && constant > 0 && (constant & (constant - 1)) == 0) {
+                    // x * 2^n == x << n, also once the product wraps
+                    int shift = 0;
+                    while ((1 << shift) != constant) {
+                        shift++;
+                    }
+                    ir->opcode[i] = LSHIFTI;
+                    ir->imm[i] = shift;
+                    reduced++;
+                } else {
+                    ir->opcode[i] = op + (ADDI - ADD);
+                    ir->imm[i] = constant;
+                }
+                ir->src2.sr[i] = -1;
+                selected++;
+            }
+        }
+        // After the rewrite, so a result that reuses the constant's register does not hide it
+        defineConstant(&constants, ir, i);
+    }
+
+    int dropped = dropUnreadConstants(ir);
+    debug(1, "Selected %d immediate forms (%d mults reduced to lshiftI), dropped %d unread loadIs",
+          selected, reduced, dropped);
+
+    freeConstantTable(&constants);
+    return selected;
+}
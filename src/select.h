@@ -0,0 +1,15 @@
+#ifndef SELECT_H
+#define SELECT_H
+
+#include "IR.h"
+
+/**
+ * Instruction selection for constant operands over the source registers of a block. An add,
+ * sub, mult, lshift or rshift whose second source holds a known constant (either source for
+ * add and mult) becomes the immediate form (addI, subI, multI, lshiftI, rshiftI), so the
+ * constant no longer needs a register; a mult by a power of two becomes an lshiftI. loadIs
+ * left without a reader are dropped. Returns the number of instructions rewritten.
+ */
+int selectImmediates(IR *ir);
+
+#endif
@@ -0,0 +1,111 @@
+#include "stats.h"
+#include "opcodes.h"
+#include "scheduler.h"
+#include "utils.h"
+#include <stdlib.h>
+
+// Register operands each opcode reads and writes
+#define READS_SRC1(op) (isLoadOp(op) || isStoreOp(op) || ((op) >= ADD && (op) <= RSHIFT) || isImmediateOp(op))
+#define READS_SRC2(op) (isStoreOp(op) || ((op) >= ADD && (op) <= RSHIFT))
+#define WRITES_DST(op) ((op) == LOADI || isLoadOp(op) || ((op) >= ADD && (op) <= RSHIFT) || isImmediateOp(op))
+
+static inline int registerIn(const OperandColumns *op, int i, RegisterForm form) {
+    switch (form) {
+        case EMIT_VR:
+            return op->vr[i];
+        case EMIT_PR:
+            return op->pr[i];
+        default:
+            return op->sr[i];
+    }
+}
+
+long estimateCycles(const IR *ir, RegisterForm form) {
+    int registers = 1;
+    for (int i = 0; i < ir->count; i++) {
+        int op = ir->opcode[i];
+        if (READS_SRC1(op) && registerIn(&ir->src1, i, form) >= registers) registers = registerIn(&ir->src1, i, form) + 1;
+        if (READS_SRC2(op) && registerIn(&ir->src2, i, form) >= registers) registers = registerIn(&ir->src2, i, form) + 1;
+        if (WRITES_DST(op) && registerIn(&ir->dst, i, form) >= registers) registers = registerIn(&ir->dst, i, form) + 1;
+    }
+    long *ready = (long *)calloc(registers, sizeof(long));  // Cycle each register's value is available
+    assertCondition(ready != NULL, "Failed to allocate register ready times");
+
+    long issue = -1;
+    long memoryReady = 0;   // Cycle the last store completes
+    long finish = 0;
+    for (int i = 0; i < ir->count; i++) {
+        int op = ir->opcode[i];
+        long start = issue + 1;
+        if (READS_SRC1(op) && ready[registerIn(&ir->src1, i, form)] > start) start = ready[registerIn(&ir->src1, i, form)];
+        if (READS_SRC2(op) && ready[registerIn(&ir->src2, i, form)] > start) start = ready[registerIn(&ir->src2, i, form)];
+        if ((isLoadOp(op) || isStoreOp(op) || op == OUTPUT) && memoryReady > start) start = memoryReady;
+        issue = start;
+
+        long done = issue + getLatency(op);
+        if (WRITES_DST(op)) {
+            ready[registerIn(&ir->dst, i, form)] = done;
+        }
+        if (isStoreOp(op)) {
+            memoryReady = done;
+        }
+        if (done > finish) {
+            finish = done;
+        }
+    }
+
+    free(ready);
+    return finish;
+}
+
+void collectStats(Allocator *allocator, AllocStats *stats) {
+    *stats = (AllocStats){
+        .k = allocator->k,
+        .maxLive = allocator->maxLive,
+        .inputCount = allocator->ir->count,
+        .outputCount = allocator->finalIR.count,
+        .spillStores = allocator->spillStores,
+        .restores = allocator->restores,
+        .cleanReloads = allocator->cleanReloads,
+        .remats = allocator->remats,
+        .spillCycles = allocator->spillCycles,
+        .spillBytes = spillAreaBytes(allocator),
+        .inputCycles = estimateCycles(allocator->ir, EMIT_SR),
+        .estimatedCycles = estimateCycles(&allocator->finalIR, EMIT_PR),
+    };
+}
+
+void printStats(const AllocStats *stats, StatsFormat format, FILE *out) {
+    if (format == STATS_JSON) {
+        fprintf(out, "{\"k\": %d, \"maxlive\": %d, \"input_instructions\": %d, \"output_instructions\": %d, "
+                     "\"spill_stores\": %d, \"restores\": %d, \"clean_reloads\": %d, \"remats\": %d, "
+                     "\"spill_cycles\": %d, \"spill_bytes\": %d, \"input_cycles\": %ld, \"estimated_cycles\": %ld}\n",
+                stats->k, stats->maxLive, stats->inputCount, stats->outputCount,
+                stats->spillStores, stats->restores, stats->cleanReloads, stats->remats,
+                stats->spillCycles, stats->spillBytes, stats->inputCycles, stats->estimatedCycles);
+        return;
+    }
+
+    fprintf(out, "// Allocation report for k = %d\n", stats->k);
+    if (stats->maxLive <= stats->k) {
+        fprintf(out, "//   MAXLIVE            %d (fits)\n", stats->maxLive);
+    } else {
+        fprintf(out, "//   MAXLIVE            %d (%d over k)\n", stats->maxLive, stats->maxLive - stats->k);
+    }
+    fprintf(out, "//   instructions       %d in, %d out\n", stats->inputCount, stats->outputCount);
+    fprintf(out, "//   estimated cycles   %ld (input block %ld)\n", stats->estimatedCycles, stats->inputCycles);
+    fprintf(out, "//   spill stores       %d\n", stats->spillStores);
+    fprintf(out, "//   restores           %d\n", stats->restores);
+    fprintf(out, "//   clean reloads      %d\n", stats->cleanReloads);
+    fprintf(out, "//   rematerialized     %d\n", stats->remats);
+    fprintf(out, "//   spill code cycles  %d\n", stats->spillCycles);
+    fprintf(out, "//   spill area         %d bytes\n", stats->spillBytes);
+}
+
+void printDeadCodeStats(int removed, int cycles, StatsFormat format, FILE *out) {
+    if (format == STATS_JSON) {
+        fprintf(out, "{\"dead_instructions\": %d, \"dead_cycles\": %d}\n", removed, cycles);
+        return;
+    }
+    fprintf(out, "// Dead code elimination removed %d instructions, %d cycles\n", removed, cycles);
+}
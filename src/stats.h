@@ -0,0 +1,54 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdio.h>
+#include "allocator.h"
+#include "emit.h"
+
+// How --stats prints its report
+typedef enum {
+    STATS_NONE,     // No report
+    STATS_TEXT,     // ILOC comment lines
+    STATS_JSON      // One JSON object per line
+} StatsFormat;
+
+// Quality of one allocation
+typedef struct AllocStats {
+    int k;
+    int maxLive;            // MAXLIVE of the input block
+    int inputCount;         // Instructions in the input block
+    int outputCount;        // Instructions in finalIR
+    int spillStores;        // Values stored to a spill slot
+    int restores;           // Values reloaded from a spill slot
+    int cleanReloads;       // Values reloaded from their original address
+    int remats;             // Values rematerialized with loadI
+    int spillCycles;        // Cycles charged to the inserted code
+    int spillBytes;         // Peak size of the spill area
+    long inputCycles;       // Estimated cycles of the input block
+    long estimatedCycles;   // Estimated cycles of finalIR
+} AllocStats;
+
+/**
+ * Estimates how many cycles the block takes on a single-issue, in-order machine with the
+ * latencies of getLatency: each instruction issues one cycle after the previous one, or once
+ * its source registers are ready, and memory operations also wait for the last store.
+ * form picks which register column carries the dependences.
+ */
+long estimateCycles(const IR *ir, RegisterForm form);
+
+/**
+ * Fills stats from an allocator whose result is in finalIR.
+ */
+void collectStats(Allocator *allocator, AllocStats *stats);
+
+/**
+ * Writes the report for one allocation to out.
+ */
+void printStats(const AllocStats *stats, StatsFormat format, FILE *out);
+
+/**
+ * Writes what eliminateDeadCode removed to out, in the same format as printStats.
+ */
+void printDeadCodeStats(int removed, int cycles, StatsFormat format, FILE *out);
+
+#endif
@@ -0,0 +1,115 @@
+#include "sweep.h"
+#include "emit.h"
+#include "utils.h"
+#include <pthread.h>
+#include <stdlib.h>
+
+// State shared by the sweep workers; each one claims the next k under the lock
+typedef struct Sweep {
+    const Allocator *base;      // Holds the one computeLastUse pass
+    SweepRange range;
+    AllocMode mode;
+    SearchBudget budget;
+    Allocator *allocators;      // One per k, kept until printed when code is wanted
+    AllocStats *results;
+    int next;                   // Offset of the next k to allocate
+    pthread_mutex_t lock;
+} Sweep;
+
+static void allocateOne(Sweep *sweep, int slot) {
+    Allocator *allocator = &sweep->allocators[slot];
+    int k = sweep->range.first + slot;
+    initAllocator(allocator, sweep->base->ir, k);
+    allocator->searchNodes = sweep->budget.nodes;
+    allocator->searchMillis = sweep->budget.millis;
+    allocator->frameSpills = sweep->base->frameSpills;
+    copyLastUse(allocator, sweep->base);
+    runAllocator(allocator, sweep->mode);
+
+    collectStats(allocator, &sweep->results[slot]);
+    if (!sweep->range.emitCode) {
+        freeAllocator(allocator);
+    }
+}
+
+static void *sweepWorker(void *arg) {
+    Sweep *sweep = (Sweep *)arg;
+    int count = sweep->range.last - sweep->range.first + 1;
+    for (;;) {
+        pthread_mutex_lock(&sweep->lock);
+        int slot = sweep->next++;
+        pthread_mutex_unlock(&sweep->lock);
+        if (slot >= count) {
+            return NULL;
+        }
+        allocateOne(sweep, slot);
+    }
+}
+
+void runSweep(IR *ir, SweepRange range, AllocMode mode, SearchBudget budget, StatsFormat stats, int threads,
+              int frameSpills, FILE *out) {
+    int count = range.last - range.first + 1;
+    assertCondition(range.first > 0 && count > 0, "Invalid register range for sweep");
+    if (threads > count) {
+        threads = count;
+    }
+
+    // Renaming and next uses do not depend on k, so one pass serves every allocator
+    Allocator base;
+    initAllocator(&base, ir, range.first);
+    base.frameSpills = frameSpills;
+    computeLastUse(&base);
+
+    Sweep sweep;
+    sweep.base = &base;
+    sweep.range = range;
+    sweep.mode = mode;
+    sweep.budget = budget;
+    sweep.allocators = (Allocator *)malloc(count * sizeof(Allocator));
+    sweep.results = (AllocStats *)malloc(count * sizeof(AllocStats));
+    sweep.next = 0;
+    assertCondition(sweep.allocators != NULL && sweep.results != NULL, "Failed to allocate sweep tables");
+    pthread_mutex_init(&sweep.lock, NULL);
+
+    if (threads <= 1) {
+        sweepWorker(&sweep);
+    } else {
+        pthread_t *workers = (pthread_t *)malloc(threads * sizeof(pthread_t));
+        assertCondition(workers != NULL, "Failed to allocate sweep workers");
+        for (int i = 0; i < threads; i++) {
+            if (pthread_create(&workers[i], NULL, sweepWorker, &sweep) != 0) {
+                error("Failed to start sweep thread");
+            }
+        }
+        for (int i = 0; i < threads; i++) {
+            pthread_join(workers[i], NULL);
+        }
+        free(workers);
+    }
+    pthread_mutex_destroy(&sweep.lock);
+
+    // Code first, then the summary, both as ILOC comments and blocks in order of k
+    if (range.emitCode) {
+        for (int slot = 0; slot < count; slot++) {
+            fprintf(out, "// k = %d\n", range.first + slot);
+            emitIR(&sweep.allocators[slot].finalIR, EMIT_PR, out, 1);
+            freeAllocator(&sweep.allocators[slot]);
+        }
+    }
+    fprintf(out, "// MAXLIVE %d\n", base.maxLive);
+    fprintf(out, "// %6s %8s %8s %8s %8s %12s %12s %10s\n", "k", "stores", "restores", "clean", "remats", "spill-cycles", "spill-bytes", "cycles");
+    for (int slot = 0; slot < count; slot++) {
+        AllocStats *r = &sweep.results[slot];
+        fprintf(out, "// %6d %8d %8d %8d %8d %12d %12d %10ld\n", r->k, r->spillStores, r->restores, r->cleanReloads, r->remats,
+                r->spillCycles, r->spillBytes, r->estimatedCycles);
+    }
+    if (stats != STATS_NONE) {
+        for (int slot = 0; slot < count; slot++) {
+            printStats(&sweep.results[slot], stats, stderr);
+        }
+    }
+
+    free(sweep.allocators);
+    free(sweep.results);
+    freeAllocator(&base);
+}
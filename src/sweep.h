@@ -0,0 +1,26 @@
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include <stdio.h>
+#include "allocator.h"
+#include "optimal.h"
+#include "stats.h"
+
+// Register counts covered by --sweep
+typedef struct SweepRange {
+    int first;      // Smallest k
+    int last;       // Largest k
+    int emitCode;   // Also print the allocated block for every k
+} SweepRange;
+
+/**
+ * Allocates ir once for every k in range with the allocator selected by mode. The block is
+ * renamed by a single computeLastUse; each k then gets its own Allocator over the shared,
+ * read-only IR, and up to threads of them run at once. Writes the code for each k (if asked)
+ * and a summary table to out, in order of k. With a stats format, the full report for
+ * each k follows on stderr. frameSpills selects loadAI/storeAI spill code for every k.
+ */
+void runSweep(IR *ir, SweepRange range, AllocMode mode, SearchBudget budget, StatsFormat stats, int threads,
+              int frameSpills, FILE *out);
+
+#endif
@@ -1,4 +1,5 @@
 #include "utils.h"
+#include "scan.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <ctype.h> 
@@ -114,3 +115,8 @@ void skip_comments(FILE *input) {
     }
 }
 
+// Buffer counterpart of skip_comments: returns the position just past the next newline
+const char *skip_comments_buffer(const char *cursor, const char *end) {
+    const char *newline = findNewline(cursor, end);
+    return (newline < end) ? newline + 1 : end;
+}
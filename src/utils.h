@@ -22,3 +22,4 @@ char passBlankspace(FILE* input);
 bool readNumber(FILE* input, int* result);
 
 void skip_comments(FILE *input);
+const char *skip_comments_buffer(const char *cursor, const char *end);
@@ -0,0 +1,252 @@
+// generated block
+//
+loadI 72 => r4
+loadI 0 => r27
+store r4 => r27
+loadI 97 => r25
+loadI 4 => r2
+store r25 => r2
+loadI 15 => r8
+loadI 8 => r15
+store r8 => r15
+loadI 57 => r24
+loadI 12 => r15
+store r24 => r15
+loadI 24 => r0
+loadI 28 => r14
+loadI 0 => r10
+loadI 24 => r28
+store r2 => r28
+output 28
+load r10 => r9
+loadI 2 => r5
+rshift r10,r5 => r23
+loadI 2 => r16
+rshift r23,r16 => r6
+nop
+output 48
+loadI 25 => r7
+loadI 49 => r17
+loadI 0 => r24
+lshift r6,r24 => r16
+store r27 => r10
+store r17 => r28
+load r14 => r16
+loadI 35 => r6
+loadI 1 => r29
+rshift r28 , r29 => r21
+store r29 => r10
+loadI 27 => r24
+mult r17 , r7 => r6
+store r28 => r10   // comment here
+loadI 0 => r19
+rshift r10, r19 => r25
+load r14 => r27
+load r10 => r1
+load r14 => r27   // comment here
+loadI 32 => r24
+load r28 => r9
+loadI 42 => r16
+store r16 => r24
+loadI 52 => r9
+mult r24,r5 => r19
+loadI 4 => r0
+loadI 27 => r22
+loadI 33 => r20
+add r24,r19 => r25
+mult r0, r5 => r28
+output 36
+sub r6, r19 => r8   // comment here
+output 4
+loadI 10 => r28
+output 4
+sub r19,r28 => r28
+loadI 0 => r15
+lshift r17 , r15 => r10
+output 0
+output 16
+loadI 48 => r21
+loadI 0 => r7
+rshift r27, r7 => r23
+loadI 17 => r29
+load r9 => r11
+loadI 38 => r7
+store r0 => r0
+store r25 => r9
+sub r0 , r16 => r3
+output 8
+loadI 23 => r2
+load r14 => r14
+loadI 0 => r1
+loadI 4 => r13
+store r6 => r13
+sub r10, r21 => r27
+nop
+mult r9,r6 => r22
+loadI 0 => r10
+output 40
+add r8 , r27 => r10
+loadI 49 => r6
+loadI 0 => r8
+lshift r8, r8 => r17
+loadI 5 => r2
+loadI 1 => r12
+rshift r28,r12 => r1
+store r22 => r13
+loadI 38 => r19
+loadI 8 => r25
+output 8   // comment here
+loadI 31 => r24
+output 12
+store r2 => r9
+loadI 16 => r24
+add r2, r0 => r4
+output 4
+store r24 => r25
+store r6 => r24
+sub r24, r27 => r8
+loadI 1 => r17
+lshift r24 , r17 => r27
+mult r16, r9 => r15
+output 0
+sub r27,r6 => r4
+loadI 0 => r19
+rshift r11,r19 => r7   // comment here
+loadI 1 => r7
+rshift r1 , r7 => r15
+loadI 32 => r13
+loadI 44 => r29
+store r20 => r0
+loadI 2 => r22
+rshift r21,r22 => r23
+output 48
+sub r4 , r24 => r15
+load r13 => r16
+add r1,r28 => r25
+add r7 , r19 => r26
+loadI 24 => r27
+output 48
+sub r7, r6 => r6
+add r22, r0 => r8
+load r0 => r16
+loadI 15 => r20
+loadI 24 => r9
+load r21 => r26
+store r25 => r0
+add r6,r8 => r28
+store r16 => r9
+loadI 48 => r9
+load r0 => r16
+store r17 => r24
+store r4 => r13
+store r20 => r13
+loadI 1 => r20
+rshift r8, r20 => r12
+nop
+store r24 => r29
+loadI 1 => r22
+rshift r7, r22 => r22
+load r21 => r11
+load r29 => r13
+loadI 2 => r22
+rshift r17,r22 => r2
+loadI 0 => r20
+load r29 => r25
+loadI 38 => r2   // comment here
+output 52
+sub r22,r22 => r8
+mult r2 , r9 => r23
+loadI 2 => r16
+lshift r25 , r16 => r5
+load r24 => r19
+sub r16, r8 => r8
+store r22 => r20
+add r16 , r22 => r20
+store r15 => r24
+loadI 60 => r17
+output 40
+loadI 2 => r27
+rshift r27 , r27 => r0
+output 28
+loadI 37 => r20
+output 16
+loadI 0 => r24
+rshift r16 , r24 => r28
+loadI 0 => r22
+lshift r1 , r22 => r22
+loadI 12 => r12
+loadI 48 => r25
+loadI 46 => r22
+load r17 => r21
+loadI 28 => r22
+loadI 1 => r7
+lshift r28 , r7 => r14
+loadI 60 => r22
+output 8   // comment here
+store r15 => r22
+store r29 => r12
+output 16
+loadI 4 => r12
+add r17, r4 => r28   // comment here
+loadI 32 => r26
+sub r15, r25 => r20
+load r17 => r21
+mult r12, r6 => r7
+store r26 => r17
+load r26 => r1
+loadI 2 => r13
+rshift r11 , r13 => r2
+load r29 => r8
+loadI 27 => r1
+loadI 32 => r2
+mult r10, r24 => r17
+loadI 28 => r12   // comment here
+add r17,r29 => r2   // comment here
+mult r7,r9 => r8
+output 36
+store r2 => r26
+output 48
+load r29 => r4
+loadI 0 => r17
+rshift r2,r17 => r28
+loadI 6 => r12
+loadI 40 => r2
+mult r29, r22 => r16
+loadI 20 => r29
+mult r24,r8 => r29
+nop
+output 4
+loadI 2 => r22
+rshift r17,r22 => r23
+output 44
+mult r26, r21 => r5
+load r26 => r29
+store r24 => r26
+load r26 => r6
+load r26 => r27
+output 20
+loadI 1 => r22
+rshift r20, r22 => r7
+output 28
+load r26 => r25
+loadI 16 => r26
+loadI 32 => r17
+loadI 37 => r19
+loadI 0 => r27
+add r21,r1 => r26
+output 0
+output 4
+output 8
+output 12
+output 16
+output 20
+output 24
+output 28
+output 32
+output 36
+output 40
+output 44
+output 48
+output 52
+output 56
+output 60
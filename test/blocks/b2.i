@@ -0,0 +1,251 @@
+// generated block
+//
+loadI 7 => r27
+loadI 0 => r2
+store r27 => r2
+loadI 46 => r2
+loadI 4 => r26
+store r2 => r26
+loadI 94 => r5
+loadI 8 => r25
+store r5 => r25
+loadI 39 => r21
+loadI 12 => r8
+store r21 => r8
+loadI 46 => r13
+mult r13,r8 => r16
+output 44
+loadI 2 => r5
+lshift r21, r5 => r5
+loadI 44 => r5
+load r5 => r28
+loadI 2 => r25
+rshift r5,r25 => r11
+nop
+store r8 => r5
+output 44
+loadI 2 => r15
+lshift r5,r15 => r7
+store r11 => r5
+nop
+loadI 2 => r9
+rshift r15,r9 => r6
+output 8
+add r21 , r26 => r1
+sub r26,r15 => r4
+loadI 4 => r28
+sub r4, r27 => r2
+loadI 23 => r23
+store r2 => r5
+load r28 => r18   // comment here
+nop
+loadI 40 => r11
+loadI 36 => r10
+store r2 => r10
+store r28 => r10
+nop
+load r5 => r0
+output 16
+store r15 => r28
+output 40
+load r28 => r20   // comment here
+load r5 => r21
+loadI 56 => r5
+add r11,r25 => r22
+loadI 39 => r7
+loadI 0 => r24
+lshift r7, r24 => r4
+loadI 15 => r16
+loadI 24 => r24   // comment here
+load r24 => r9
+sub r10, r10 => r16
+loadI 37 => r13
+loadI 0 => r25
+output 44
+nop
+loadI 12 => r21
+store r2 => r21
+loadI 24 => r20
+load r5 => r9   // comment here
+add r25, r5 => r6
+loadI 0 => r12
+lshift r13, r12 => r8
+load r10 => r20
+loadI 60 => r3
+store r9 => r24
+mult r7,r21 => r16
+store r5 => r24
+sub r5,r5 => r19
+load r21 => r29
+store r21 => r25
+loadI 52 => r17
+store r13 => r5
+mult r0,r5 => r16
+loadI 0 => r16
+lshift r21 , r16 => r22
+output 56
+loadI 48 => r27
+loadI 38 => r14
+store r22 => r3
+mult r6,r12 => r29
+loadI 2 => r23
+rshift r4 , r23 => r2
+load r3 => r26
+nop
+loadI 29 => r14
+store r19 => r5
+store r10 => r3
+loadI 12 => r26
+output 24
+load r5 => r19
+loadI 0 => r22
+rshift r28, r22 => r24
+output 8
+mult r14 , r24 => r28
+nop
+loadI 0 => r1
+lshift r22,r1 => r15
+load r10 => r0
+add r12,r5 => r17
+loadI 16 => r21
+mult r16,r7 => r26
+load r25 => r20
+add r19 , r11 => r12
+output 8
+loadI 33 => r14
+nop
+store r12 => r21
+mult r14,r12 => r5
+sub r22,r10 => r29
+loadI 44 => r7
+loadI 48 => r4
+store r4 => r21
+output 40
+store r7 => r4
+nop
+load r4 => r2
+sub r7,r6 => r14
+output 40
+loadI 20 => r0
+output 52   // comment here
+loadI 1 => r9
+rshift r3, r9 => r20
+loadI 16 => r15
+sub r17, r12 => r8
+loadI 2 => r7
+loadI 0 => r5
+rshift r8,r5 => r13
+loadI 7 => r16
+store r16 => r4
+loadI 40 => r24
+load r25 => r18
+load r24 => r12
+loadI 0 => r14
+lshift r3, r14 => r28
+load r25 => r29
+sub r16,r16 => r9
+loadI 14 => r3
+loadI 21 => r21
+load r10 => r27
+loadI 0 => r15
+add r21, r18 => r17
+loadI 1 => r11
+rshift r21, r11 => r0
+loadI 4 => r14
+load r4 => r19
+loadI 2 => r29
+rshift r26 , r29 => r5
+store r11 => r14
+loadI 52 => r10
+mult r15, r5 => r17
+loadI 2 => r13
+lshift r4 , r13 => r4
+loadI 12 => r19
+add r2, r7 => r20
+store r1 => r24   // comment here
+store r0 => r25
+sub r28 , r7 => r20
+loadI 29 => r2
+nop
+mult r19 , r19 => r16
+output 4
+load r10 => r20
+add r10,r17 => r10
+loadI 0 => r28
+rshift r12, r28 => r13
+store r10 => r14
+loadI 0 => r19
+lshift r5,r19 => r18
+store r16 => r24
+loadI 2 => r19
+lshift r0 , r19 => r21
+load r24 => r27
+store r18 => r24   // comment here
+output 24
+loadI 40 => r17
+loadI 1 => r15
+load r24 => r4
+store r4 => r25
+load r17 => r15
+output 16
+store r19 => r24
+output 40
+store r23 => r17
+load r14 => r21
+output 48
+loadI 60 => r14
+sub r27 , r25 => r17
+loadI 3 => r17
+sub r4,r1 => r3
+loadI 2 => r23
+lshift r7,r23 => r7   // comment here
+sub r16, r29 => r10
+load r14 => r9
+loadI 43 => r17
+sub r13 , r29 => r16
+loadI 40 => r17
+loadI 44 => r11
+output 32
+output 16   // comment here
+add r7, r17 => r22
+loadI 49 => r17
+sub r25 , r5 => r0
+store r12 => r14
+output 4
+load r24 => r12
+loadI 2 => r7
+rshift r7, r7 => r6   // comment here
+loadI 0 => r20
+rshift r0 , r20 => r1
+loadI 1 => r4
+lshift r29,r4 => r4
+loadI 56 => r18
+load r11 => r5
+nop
+loadI 9 => r8
+load r14 => r14
+loadI 28 => r13
+load r25 => r26
+store r14 => r18
+loadI 36 => r29
+loadI 2 => r16
+lshift r20 , r16 => r14
+store r20 => r24
+output 44
+sub r9 , r20 => r13
+output 0
+output 4
+output 8
+output 12
+output 16
+output 20
+output 24
+output 28
+output 32
+output 36
+output 40
+output 44
+output 48
+output 52
+output 56
+output 60
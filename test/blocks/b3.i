@@ -0,0 +1,251 @@
+// generated block
+//
+loadI 75 => r7
+loadI 0 => r17
+store r7 => r17
+loadI 47 => r4
+loadI 4 => r29
+store r4 => r29
+loadI 60 => r19
+loadI 8 => r20
+store r19 => r20
+loadI 8 => r18
+loadI 12 => r19
+store r18 => r19
+loadI 28 => r26
+store r18 => r26
+loadI 48 => r20
+load r26 => r5
+load r20 => r24   // comment here
+output 60
+output 48
+output 48
+load r26 => r28
+loadI 52 => r15
+output 52
+mult r26 , r20 => r13
+add r15 , r19 => r19
+load r20 => r17
+load r15 => r20
+store r20 => r15
+loadI 0 => r25
+lshift r4, r25 => r13   // comment here
+loadI 2 => r19
+lshift r29, r19 => r24
+load r15 => r16
+loadI 4 => r0
+nop
+add r5, r5 => r11
+loadI 2 => r20
+lshift r17 , r20 => r21
+nop
+sub r20 , r15 => r8
+loadI 1 => r0
+lshift r25 , r0 => r19
+loadI 44 => r20
+mult r0 , r19 => r0
+load r15 => r8
+loadI 0 => r11
+rshift r19,r11 => r10
+loadI 2 => r18
+lshift r18, r18 => r23
+loadI 40 => r25
+add r18 , r19 => r10
+sub r20 , r24 => r23
+load r20 => r7
+loadI 20 => r6
+add r23, r16 => r18
+mult r19,r16 => r20
+load r26 => r29
+loadI 39 => r15
+sub r4 , r19 => r26
+nop
+output 8
+nop
+loadI 44 => r1
+loadI 36 => r28   // comment here
+add r5, r8 => r9
+loadI 1 => r3
+lshift r29,r3 => r4
+add r16, r13 => r6
+store r19 => r25
+output 16
+loadI 25 => r20   // comment here
+mult r23,r11 => r16
+add r16, r29 => r24   // comment here
+loadI 45 => r15
+mult r5,r19 => r2
+mult r0,r17 => r6
+loadI 24 => r0
+load r25 => r11
+load r25 => r20
+load r25 => r1
+mult r21,r11 => r22
+loadI 8 => r17
+loadI 20 => r4
+output 32
+load r17 => r21
+loadI 0 => r15
+rshift r15,r15 => r7   // comment here
+loadI 24 => r3
+loadI 1 => r26
+load r17 => r18
+loadI 33 => r24
+loadI 4 => r23
+output 20
+loadI 29 => r5
+store r8 => r17
+mult r18,r20 => r2
+nop
+store r20 => r25
+store r21 => r23
+loadI 9 => r12
+loadI 2 => r18
+lshift r21, r18 => r27
+store r5 => r25
+output 36
+output 32
+mult r20, r28 => r6
+loadI 9 => r15
+load r23 => r19
+load r23 => r17   // comment here
+nop
+output 4
+loadI 49 => r7
+nop
+loadI 8 => r6
+store r8 => r25
+loadI 8 => r5
+mult r19 , r15 => r14
+add r18,r18 => r13
+loadI 31 => r18
+add r18,r20 => r21
+output 32
+output 44
+loadI 2 => r21
+lshift r25,r21 => r20
+output 40
+add r5,r22 => r16
+loadI 2 => r20
+rshift r0, r20 => r20
+output 56
+output 16
+load r5 => r19
+sub r6, r20 => r9
+loadI 34 => r5
+add r10, r10 => r12
+loadI 44 => r16
+output 56
+store r22 => r23
+loadI 43 => r8
+store r13 => r16
+loadI 25 => r13
+store r18 => r16
+sub r3 , r15 => r5
+output 44
+loadI 52 => r25
+loadI 1 => r20
+rshift r5 , r20 => r16
+output 60   // comment here
+loadI 28 => r20
+loadI 2 => r25
+lshift r20, r25 => r6
+output 56
+sub r20, r0 => r25
+loadI 32 => r11
+mult r6,r18 => r27
+loadI 49 => r27
+store r25 => r20
+loadI 28 => r6
+loadI 24 => r1
+loadI 1 => r17
+lshift r21 , r17 => r6
+loadI 25 => r14
+add r16,r8 => r11
+loadI 0 => r25
+lshift r0,r25 => r8
+sub r19, r21 => r0
+add r20, r13 => r19
+loadI 56 => r26
+loadI 48 => r22   // comment here
+sub r20,r28 => r12
+add r29 , r6 => r3
+store r12 => r1
+mult r1,r0 => r17   // comment here
+mult r19 , r0 => r1
+loadI 0 => r19
+loadI 4 => r16
+mult r4,r19 => r10
+output 4
+store r8 => r16
+loadI 2 => r12
+lshift r19 , r12 => r10
+output 20
+output 48
+load r20 => r11
+loadI 0 => r8
+lshift r26 , r8 => r16
+output 48
+loadI 1 => r5
+loadI 6 => r22
+load r23 => r28
+loadI 46 => r14
+nop   // comment here
+loadI 6 => r25
+loadI 2 => r7
+lshift r19, r7 => r1
+loadI 36 => r0
+loadI 32 => r17
+load r0 => r25
+loadI 12 => r2
+output 12
+output 8
+loadI 2 => r24
+rshift r8 , r24 => r27
+load r19 => r24
+store r6 => r0
+loadI 36 => r17
+loadI 8 => r11
+load r2 => r13
+loadI 44 => r16
+loadI 8 => r7
+sub r24 , r11 => r29
+sub r20,r26 => r28
+load r23 => r9
+loadI 16 => r28
+loadI 0 => r23
+lshift r5,r23 => r8
+sub r23,r23 => r3
+add r6 , r23 => r15
+mult r6,r11 => r9
+nop
+nop
+loadI 19 => r11
+output 0   // comment here
+load r19 => r17   // comment here
+nop   // comment here
+nop
+mult r25, r26 => r15
+mult r15, r16 => r17
+loadI 0 => r10
+lshift r25,r10 => r0   // comment here
+nop
+store r22 => r16
+store r16 => r28
+store r10 => r16
+output 0
+output 4
+output 8
+output 12
+output 16
+output 20
+output 24
+output 28
+output 32
+output 36
+output 40
+output 44
+output 48
+output 52
+output 56
+output 60
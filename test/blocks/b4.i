@@ -0,0 +1,248 @@
+// generated block
+//
+loadI 38 => r7
+loadI 0 => r3
+store r7 => r3
+loadI 50 => r23
+loadI 4 => r15
+store r23 => r15
+loadI 11 => r4
+loadI 8 => r2
+store r4 => r2
+loadI 51 => r0
+loadI 12 => r17
+store r0 => r17
+output 4
+mult r23, r3 => r8
+loadI 17 => r20
+mult r3 , r20 => r10
+loadI 8 => r7
+store r7 => r7
+load r7 => r27
+loadI 27 => r13
+loadI 2 => r8
+mult r8,r8 => r20
+loadI 52 => r21
+load r21 => r8
+loadI 1 => r6
+rshift r10, r6 => r3
+loadI 1 => r3
+rshift r3, r3 => r29
+loadI 18 => r11
+nop   // comment here
+sub r3 , r13 => r27
+loadI 56 => r19
+loadI 0 => r18
+rshift r2, r18 => r11
+mult r20,r6 => r3
+sub r15, r3 => r1
+load r7 => r19   // comment here
+sub r10 , r3 => r3
+nop
+loadI 52 => r6
+loadI 52 => r14
+add r23, r21 => r8
+store r21 => r14
+loadI 12 => r29
+add r6,r19 => r2
+output 20
+load r6 => r26
+loadI 17 => r25
+loadI 2 => r20
+lshift r4, r20 => r6
+load r14 => r21
+output 56
+store r13 => r14
+loadI 32 => r5
+store r8 => r5
+output 24
+load r5 => r29
+loadI 7 => r1
+output 16   // comment here
+loadI 0 => r28
+add r2,r29 => r14
+nop
+store r0 => r5
+output 44
+loadI 0 => r28
+lshift r4,r28 => r20
+add r2, r10 => r11
+loadI 16 => r15
+output 20   // comment here
+loadI 2 => r25
+rshift r17,r25 => r19
+loadI 0 => r7
+lshift r6 , r7 => r27   // comment here
+loadI 56 => r29
+load r29 => r19
+mult r15 , r20 => r11
+loadI 2 => r25
+rshift r20,r25 => r5
+loadI 2 => r21
+rshift r25, r21 => r28
+load r29 => r10
+mult r11, r3 => r19
+store r19 => r29
+store r10 => r29
+nop
+nop
+output 12
+sub r6 , r25 => r26
+output 48
+loadI 19 => r15
+store r19 => r29
+nop
+loadI 2 => r5
+rshift r3 , r5 => r14
+store r15 => r29
+loadI 44 => r2
+add r8 , r10 => r7
+output 8
+loadI 4 => r9
+store r7 => r9
+sub r27,r11 => r1
+mult r11,r3 => r20
+output 8
+load r9 => r28
+sub r3 , r20 => r15
+loadI 32 => r27
+load r2 => r10
+loadI 0 => r0
+store r3 => r29
+load r29 => r7
+loadI 11 => r29
+loadI 2 => r26
+lshift r1, r26 => r18
+load r9 => r9
+store r0 => r0
+store r14 => r2
+store r10 => r0
+add r3, r21 => r28
+load r0 => r16
+nop
+loadI 28 => r1   // comment here
+load r0 => r25
+loadI 0 => r9
+loadI 1 => r8
+nop   // comment here
+load r0 => r11
+store r20 => r1
+load r9 => r1
+add r5 , r5 => r9
+store r5 => r0
+loadI 32 => r28
+output 52
+load r0 => r8
+loadI 43 => r8
+loadI 20 => r24
+store r25 => r28
+load r2 => r20
+sub r29 , r7 => r7
+loadI 16 => r10
+loadI 45 => r27
+store r9 => r0
+loadI 47 => r10
+load r28 => r5
+loadI 43 => r1
+output 32
+load r24 => r3
+store r10 => r24
+mult r28,r19 => r23
+store r27 => r2
+loadI 24 => r7
+load r24 => r11
+loadI 44 => r7
+add r15,r20 => r6
+store r26 => r7
+nop
+store r8 => r0
+load r28 => r11   // comment here
+load r24 => r0
+output 52
+loadI 0 => r28
+rshift r20, r28 => r15
+sub r7 , r29 => r7
+loadI 52 => r21
+load r21 => r1
+load r2 => r13
+mult r29 , r8 => r11
+load r21 => r29
+load r21 => r1
+sub r26, r28 => r26
+load r2 => r5
+store r6 => r21
+store r9 => r2
+store r3 => r21
+add r25,r28 => r28
+mult r2, r11 => r24
+loadI 2 => r11
+lshift r2,r11 => r19
+add r3, r29 => r25
+store r7 => r2
+store r7 => r2   // comment here
+loadI 33 => r9
+loadI 20 => r20
+loadI 0 => r2
+rshift r20, r2 => r13
+nop
+mult r29 , r3 => r18
+load r21 => r5   // comment here
+loadI 0 => r24
+lshift r7,r24 => r16
+loadI 60 => r19
+load r21 => r18
+nop
+load r19 => r23
+load r20 => r5
+mult r18,r27 => r17
+sub r18, r19 => r27
+sub r14,r7 => r3   // comment here
+loadI 41 => r27
+loadI 48 => r29
+load r29 => r9
+add r19,r20 => r1   // comment here
+nop
+store r20 => r20
+sub r7, r11 => r11
+load r29 => r11
+add r5,r21 => r2
+loadI 12 => r0
+mult r7 , r9 => r12
+store r8 => r21
+nop
+store r24 => r29
+load r0 => r5
+mult r23 , r20 => r16
+load r0 => r5
+loadI 52 => r16
+add r9 , r15 => r26
+mult r25,r26 => r10
+loadI 0 => r25
+rshift r11,r25 => r15
+loadI 2 => r8
+rshift r8 , r8 => r19
+load r20 => r27   // comment here
+nop
+add r7,r21 => r24
+store r2 => r0
+store r20 => r21
+store r25 => r20
+loadI 0 => r5
+rshift r15, r5 => r0
+loadI 20 => r0
+output 0
+output 4
+output 8
+output 12
+output 16
+output 20
+output 24
+output 28
+output 32
+output 36
+output 40
+output 44
+output 48
+output 52
+output 56
+output 60
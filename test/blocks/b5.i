@@ -0,0 +1,252 @@
+// generated block
+//
+loadI 32 => r19
+loadI 0 => r23
+store r19 => r23
+loadI 88 => r11
+loadI 4 => r26
+store r11 => r26
+loadI 83 => r23
+loadI 8 => r29
+store r23 => r29
+loadI 3 => r16
+loadI 12 => r26
+store r16 => r26
+sub r19,r11 => r3
+loadI 28 => r17   // comment here
+loadI 48 => r8
+store r17 => r17
+loadI 0 => r0
+loadI 18 => r5
+loadI 13 => r28
+nop
+nop
+loadI 16 => r13
+loadI 2 => r19
+rshift r17,r19 => r22
+mult r19,r8 => r5
+loadI 1 => r8
+loadI 1 => r25
+lshift r19,r25 => r11
+loadI 39 => r1
+loadI 56 => r24
+loadI 2 => r3
+rshift r3,r3 => r23
+loadI 44 => r2
+loadI 1 => r21
+rshift r11, r21 => r9
+load r24 => r15
+loadI 25 => r19   // comment here
+store r21 => r24
+load r13 => r1
+load r2 => r10
+loadI 8 => r23
+store r8 => r17
+loadI 16 => r27
+nop
+nop
+mult r1,r5 => r9
+loadI 34 => r12
+load r2 => r27
+loadI 35 => r8
+mult r8,r11 => r24
+store r10 => r13
+nop
+nop
+loadI 32 => r27
+mult r23,r24 => r11
+store r24 => r27
+loadI 23 => r27
+loadI 1 => r26
+rshift r8,r26 => r29
+loadI 10 => r21
+output 52
+load r2 => r8
+loadI 39 => r5
+loadI 4 => r21
+nop
+output 12
+loadI 26 => r6
+loadI 0 => r6
+rshift r23,r6 => r22   // comment here
+mult r21 , r26 => r22
+loadI 36 => r19
+loadI 0 => r26
+rshift r8,r26 => r13
+load r21 => r14
+load r19 => r6
+load r21 => r26
+loadI 16 => r3
+output 48
+nop
+loadI 0 => r29
+lshift r23 , r29 => r19
+nop
+mult r19,r25 => r15
+loadI 28 => r21
+loadI 0 => r4
+load r17 => r29
+loadI 16 => r15
+loadI 0 => r0
+lshift r19,r0 => r9
+mult r9,r26 => r14
+store r23 => r2   // comment here
+load r17 => r28
+loadI 27 => r13
+load r15 => r27
+loadI 0 => r14
+lshift r2, r14 => r9
+mult r19, r27 => r4
+loadI 1 => r4
+lshift r26 , r4 => r18
+loadI 8 => r7
+load r17 => r10
+nop
+store r19 => r17
+loadI 7 => r20
+loadI 28 => r9
+load r15 => r25
+load r17 => r17
+add r12 , r26 => r18
+loadI 0 => r13
+rshift r5 , r13 => r10
+mult r26,r5 => r22
+load r15 => r29
+sub r27, r3 => r17
+store r1 => r3
+loadI 0 => r22
+lshift r24,r22 => r20
+load r2 => r27
+load r3 => r12
+mult r28 , r9 => r0
+loadI 27 => r4
+loadI 60 => r3
+loadI 28 => r19
+output 44
+mult r17 , r8 => r25
+output 4
+load r3 => r12
+loadI 4 => r5
+output 44   // comment here
+loadI 1 => r14
+rshift r13, r14 => r3
+loadI 30 => r11
+mult r11 , r19 => r9
+add r21,r19 => r11
+load r19 => r15
+loadI 18 => r25
+loadI 0 => r5
+load r5 => r29
+mult r3,r29 => r11
+nop
+store r22 => r7
+loadI 32 => r19   // comment here
+loadI 10 => r24   // comment here
+loadI 2 => r3
+rshift r14, r3 => r2
+loadI 2 => r7
+lshift r16,r7 => r1
+loadI 28 => r8
+loadI 12 => r1
+loadI 0 => r7
+lshift r23,r7 => r29
+loadI 8 => r29
+loadI 44 => r0
+load r0 => r16
+store r17 => r29
+store r13 => r5
+add r5,r12 => r8
+loadI 8 => r2
+nop
+loadI 2 => r1
+lshift r22,r1 => r6
+output 8
+loadI 2 => r9
+rshift r19, r9 => r24
+add r5, r11 => r8
+sub r17, r22 => r9
+mult r9 , r3 => r2
+load r19 => r3
+loadI 32 => r11
+load r5 => r16
+mult r27 , r26 => r5
+loadI 20 => r3
+loadI 27 => r24
+sub r7,r24 => r5   // comment here
+load r29 => r17
+add r21,r23 => r26
+loadI 28 => r0
+output 48
+loadI 44 => r26
+store r20 => r0
+store r19 => r26
+sub r27,r15 => r15   // comment here
+loadI 18 => r3
+loadI 30 => r25
+output 8
+add r21 , r2 => r19
+store r25 => r29
+load r26 => r16
+store r1 => r26
+store r24 => r29
+loadI 1 => r6
+rshift r29, r6 => r9   // comment here
+store r10 => r26
+loadI 4 => r29   // comment here
+loadI 44 => r9
+output 24
+loadI 52 => r3
+loadI 24 => r12
+load r3 => r10
+load r12 => r22
+add r13,r4 => r9
+loadI 52 => r5
+loadI 40 => r2
+output 52
+loadI 1 => r9
+rshift r3, r9 => r8
+nop
+loadI 20 => r3
+add r13,r25 => r1
+add r25,r6 => r27
+output 28
+load r3 => r26
+loadI 40 => r5
+load r0 => r18
+store r26 => r11
+load r0 => r11
+loadI 20 => r6
+load r0 => r7
+loadI 1 => r19
+lshift r23 , r19 => r4   // comment here
+mult r8 , r1 => r24
+loadI 44 => r25
+loadI 36 => r10
+load r10 => r25
+loadI 8 => r13
+loadI 17 => r13
+loadI 35 => r8
+nop
+sub r3, r1 => r11
+loadI 0 => r24   // comment here
+load r5 => r27
+loadI 56 => r6   // comment here
+mult r12 , r25 => r15   // comment here
+loadI 27 => r24
+output 4
+output 0
+output 4
+output 8
+output 12
+output 16
+output 20
+output 24
+output 28
+output 32
+output 36
+output 40
+output 44
+output 48
+output 52
+output 56
+output 60
@@ -0,0 +1,259 @@
+// generated block
+//
+loadI 73 => r25
+loadI 0 => r26
+store r25 => r26
+loadI 62 => r2
+loadI 4 => r24
+store r2 => r24
+loadI 4 => r8
+loadI 8 => r0
+store r8 => r0
+loadI 84 => r4
+loadI 12 => r18
+store r4 => r18
+mult r0,r25 => r8
+loadI 2 => r6
+rshift r8 , r6 => r17
+loadI 1 => r27
+rshift r17, r27 => r10
+mult r18, r27 => r3
+loadI 12 => r1
+output 60
+output 0
+loadI 12 => r13
+output 24
+load r13 => r23
+sub r4, r23 => r0
+loadI 42 => r10
+loadI 0 => r9
+lshift r23,r9 => r21
+loadI 0 => r7
+lshift r24 , r7 => r28
+output 56
+add r23,r3 => r15
+add r4,r15 => r21
+store r25 => r13   // comment here
+loadI 12 => r18
+loadI 1 => r29
+rshift r8,r29 => r19
+loadI 1 => r23
+lshift r13,r23 => r15
+mult r7 , r0 => r29
+load r13 => r20
+sub r10,r25 => r19
+loadI 7 => r19
+loadI 1 => r4
+lshift r24, r4 => r19
+store r8 => r13
+loadI 43 => r11
+load r13 => r1
+loadI 60 => r3
+output 0
+loadI 10 => r26
+output 56
+loadI 24 => r20
+loadI 1 => r8
+lshift r23 , r8 => r22
+store r10 => r3
+loadI 17 => r16
+loadI 0 => r22
+lshift r15 , r22 => r7
+add r27, r7 => r11
+nop
+output 52
+loadI 25 => r23
+loadI 0 => r4
+lshift r20 , r4 => r11
+loadI 36 => r22
+loadI 2 => r7
+lshift r22 , r7 => r18
+sub r4 , r21 => r7
+store r10 => r22
+output 56   // comment here
+store r7 => r3
+mult r0, r22 => r5
+load r22 => r2
+loadI 12 => r24
+load r13 => r17
+loadI 1 => r2
+rshift r22 , r2 => r2
+loadI 7 => r28
+store r24 => r3
+loadI 46 => r26
+store r23 => r20
+store r22 => r24
+add r23 , r19 => r25
+nop
+load r24 => r2
+load r20 => r11
+loadI 40 => r24
+store r22 => r13
+loadI 56 => r2
+loadI 14 => r18
+sub r20,r11 => r19
+load r22 => r29
+loadI 56 => r28
+loadI 0 => r3
+loadI 60 => r18
+loadI 2 => r26
+rshift r28,r26 => r28
+output 0
+sub r11 , r23 => r18
+loadI 52 => r9
+store r27 => r9
+sub r2 , r4 => r16
+mult r22,r18 => r12
+store r19 => r13
+loadI 9 => r19
+add r27,r13 => r6
+nop
+loadI 16 => r5
+store r19 => r24
+load r24 => r25
+sub r22, r6 => r8
+loadI 30 => r28
+add r26 , r19 => r28
+output 40
+store r10 => r22
+loadI 47 => r21
+loadI 9 => r17
+add r23,r21 => r17
+loadI 0 => r27
+lshift r18,r27 => r14
+mult r1,r29 => r22
+nop
+loadI 0 => r23
+store r19 => r9
+store r26 => r24
+load r20 => r4
+mult r27 , r23 => r6
+load r13 => r26
+sub r22 , r15 => r15
+loadI 2 => r3
+rshift r19, r3 => r23
+loadI 38 => r28
+loadI 32 => r1
+load r24 => r9
+store r3 => r13
+output 20
+loadI 4 => r16
+loadI 8 => r14
+add r8,r4 => r22
+add r6,r1 => r9
+mult r29, r23 => r0
+loadI 1 => r25
+lshift r9 , r25 => r20
+output 12
+nop
+loadI 8 => r8
+store r9 => r2
+loadI 26 => r6
+loadI 2 => r10
+rshift r25, r10 => r14
+sub r28,r9 => r4
+loadI 2 => r8
+rshift r23 , r8 => r26
+load r24 => r23   // comment here
+loadI 41 => r18   // comment here
+loadI 1 => r29
+lshift r25,r29 => r12
+store r28 => r2
+loadI 2 => r9
+rshift r15,r9 => r21
+loadI 1 => r18
+rshift r21,r18 => r21
+loadI 0 => r13
+loadI 4 => r2
+store r18 => r16
+sub r26,r19 => r2
+loadI 14 => r11
+loadI 2 => r11
+rshift r18 , r11 => r0
+loadI 2 => r0
+lshift r14, r0 => r25   // comment here
+loadI 12 => r0
+loadI 0 => r11
+lshift r7, r11 => r3   // comment here
+loadI 44 => r8
+loadI 40 => r22
+store r1 => r8
+loadI 2 => r29
+load r24 => r29
+output 8
+loadI 12 => r19
+store r21 => r0
+output 20
+store r24 => r24
+mult r3,r26 => r0
+sub r7 , r9 => r17
+store r28 => r16
+output 20
+load r5 => r20
+mult r16, r8 => r14
+loadI 4 => r13
+mult r14 , r6 => r11
+sub r24,r22 => r19
+load r24 => r4
+loadI 1 => r17
+lshift r24 , r17 => r1   // comment here
+mult r25,r19 => r27
+loadI 16 => r18
+loadI 2 => r18
+rshift r27, r18 => r29
+load r5 => r6
+nop   // comment here
+mult r7,r4 => r24
+load r5 => r1
+load r16 => r16
+mult r7,r24 => r11
+store r10 => r5
+store r1 => r8
+store r22 => r5
+loadI 2 => r29
+rshift r26,r29 => r18
+load r8 => r25
+load r5 => r1
+loadI 42 => r29
+loadI 20 => r16
+loadI 60 => r28
+store r26 => r28
+loadI 0 => r1
+loadI 0 => r15
+rshift r29, r15 => r0
+load r13 => r7
+loadI 2 => r10
+lshift r14, r10 => r20
+loadI 29 => r25
+loadI 40 => r9
+add r11 , r24 => r7
+store r4 => r28
+loadI 1 => r14
+lshift r29, r14 => r6
+output 32
+add r9, r15 => r5
+loadI 0 => r6
+lshift r27,r6 => r3
+store r24 => r13
+load r8 => r22
+load r28 => r2
+store r0 => r1
+output 56
+nop
+add r13,r11 => r12
+output 0
+output 4
+output 8
+output 12
+output 16
+output 20
+output 24
+output 28
+output 32
+output 36
+output 40
+output 44
+output 48
+output 52
+output 56
+output 60
@@ -0,0 +1,3396 @@
+// generated block
+//
+loadI 19 => r82
+loadI 0 => r101
+store r82 => r101
+loadI 6 => r166
+loadI 4 => r18
+store r166 => r18
+loadI 12 => r137
+loadI 8 => r93
+store r137 => r93
+loadI 7 => r149
+loadI 12 => r129
+store r149 => r129
+loadI 8 => r22
+load r22 => r144
+loadI 3 => r160
+sub r82,r22 => r34
+loadI 0 => r174
+rshift r137 , r174 => r26
+loadI 4 => r24
+load r22 => r174
+store r24 => r22
+loadI 15 => r46
+loadI 2 => r73
+lshift r160, r73 => r18
+loadI 60 => r87
+nop
+load r87 => r87
+load r22 => r17
+output 60
+loadI 41 => r187
+load r22 => r72
+output 44   // comment here
+sub r87, r18 => r126
+sub r174, r174 => r127
+mult r137,r26 => r140
+nop
+sub r137, r166 => r45
+loadI 11 => r124
+loadI 39 => r107
+nop
+loadI 0 => r189
+rshift r87 , r189 => r116
+loadI 2 => r123
+lshift r127, r123 => r102
+nop
+loadI 0 => r153
+mult r101 , r137 => r53
+load r153 => r154
+loadI 29 => r124
+sub r149,r17 => r189
+load r22 => r52
+sub r153 , r101 => r194
+load r22 => r178
+sub r187 , r24 => r136
+sub r52,r174 => r61
+loadI 0 => r132
+store r46 => r153
+load r153 => r114
+store r72 => r153
+loadI 24 => r120
+nop
+loadI 8 => r167
+loadI 48 => r99
+output 52
+loadI 0 => r190
+lshift r107, r190 => r185
+loadI 29 => r38
+loadI 42 => r152
+loadI 0 => r140
+store r102 => r22
+loadI 13 => r49   // comment here
+loadI 40 => r128
+sub r18,r167 => r90
+store r140 => r167
+output 16
+add r128, r124 => r198
+store r34 => r153
+load r22 => r142
+load r167 => r142
+store r18 => r167
+add r123, r124 => r143
+output 56
+nop
+loadI 60 => r70
+loadI 16 => r133
+output 24
+loadI 40 => r31
+loadI 36 => r18
+output 16
+load r140 => r36
+loadI 12 => r119
+sub r87,r128 => r131
+loadI 44 => r81   // comment here
+load r70 => r180   // comment here
+loadI 0 => r16
+rshift r124, r16 => r58
+sub r153 , r46 => r108
+sub r81,r36 => r146
+loadI 11 => r14
+loadI 16 => r4
+output 8
+loadI 52 => r2
+sub r93, r131 => r181
+nop
+loadI 33 => r79
+loadI 0 => r88
+rshift r187, r88 => r64   // comment here
+store r126 => r31
+loadI 52 => r114
+loadI 0 => r176
+lshift r18,r176 => r58
+output 16
+add r46 , r101 => r18
+sub r129,r160 => r170
+load r167 => r153
+loadI 1 => r68
+lshift r72,r68 => r0
+loadI 1 => r8
+rshift r178,r8 => r55
+add r143 , r53 => r128
+add r34, r102 => r22
+loadI 28 => r5
+nop
+loadI 38 => r183
+loadI 2 => r185
+lshift r87, r185 => r164   // comment here
+store r64 => r2
+store r73 => r2
+store r166 => r114
+load r5 => r177
+loadI 44 => r10
+loadI 0 => r160
+lshift r58 , r160 => r160
+add r142 , r22 => r191
+loadI 60 => r134
+loadI 24 => r67
+load r81 => r126
+loadI 4 => r175
+load r120 => r153
+mult r88, r108 => r34
+add r0,r45 => r172
+loadI 0 => r196
+lshift r142, r196 => r140
+loadI 56 => r121
+loadI 0 => r53
+lshift r153 , r53 => r19
+store r120 => r31
+store r53 => r114
+store r31 => r70
+add r87 , r82 => r125
+sub r140,r132 => r96
+mult r164, r61 => r101
+loadI 18 => r3
+loadI 37 => r99
+output 32
+add r153 , r18 => r73
+loadI 40 => r68
+loadI 2 => r194
+lshift r19 , r194 => r102
+store r73 => r120
+sub r176,r121 => r73   // comment here
+output 16
+mult r189 , r123 => r189
+sub r189 , r70 => r142
+loadI 60 => r41
+mult r177, r198 => r109
+loadI 8 => r44
+loadI 1 => r191
+rshift r38,r191 => r98
+loadI 4 => r69
+load r134 => r32
+sub r72,r180 => r63
+mult r93,r123 => r8
+output 60
+add r160, r73 => r114
+loadI 43 => r38
+store r17 => r68
+loadI 4 => r32
+sub r18,r114 => r162
+loadI 24 => r18
+loadI 36 => r153
+mult r133, r194 => r134
+loadI 19 => r105
+loadI 5 => r172
+load r175 => r58
+load r68 => r92
+loadI 32 => r74
+sub r88,r190 => r59
+store r45 => r10
+sub r198 , r189 => r106
+load r121 => r13
+nop
+loadI 56 => r15
+output 12
+output 40
+load r69 => r191
+loadI 0 => r113
+lshift r185, r113 => r27
+loadI 7 => r107
+store r128 => r121
+loadI 1 => r180
+lshift r187,r180 => r50
+mult r5 , r194 => r7
+store r160 => r121
+add r36, r190 => r191
+mult r170,r7 => r11
+load r5 => r76   // comment here
+store r46 => r15   // comment here
+loadI 29 => r121
+mult r140,r41 => r33
+store r189 => r10
+mult r3, r22 => r152
+sub r31 , r126 => r16   // comment here
+load r67 => r41
+output 8
+loadI 56 => r24
+loadI 43 => r117
+add r4 , r4 => r71
+mult r185, r53 => r63
+loadI 8 => r148
+nop
+loadI 2 => r25
+sub r125,r185 => r10
+loadI 37 => r153
+loadI 28 => r131
+store r45 => r132
+store r128 => r68   // comment here
+add r152 , r36 => r9
+output 0
+mult r167, r191 => r79
+store r73 => r24
+loadI 9 => r101
+loadI 32 => r41
+mult r153 , r26 => r79
+loadI 0 => r164
+lshift r137 , r164 => r100
+output 52
+add r67,r59 => r93
+loadI 41 => r13
+loadI 2 => r188
+rshift r11, r188 => r43
+loadI 6 => r43
+store r181 => r81
+output 60
+load r44 => r22
+load r119 => r163
+loadI 12 => r103
+loadI 20 => r55
+loadI 12 => r63   // comment here
+load r120 => r170
+loadI 36 => r153
+sub r172,r160 => r168
+add r82,r191 => r125
+store r114 => r32
+add r123,r128 => r110
+loadI 2 => r10
+rshift r71, r10 => r33
+loadI 2 => r192
+rshift r87 , r192 => r96
+loadI 46 => r16
+loadI 31 => r33
+store r9 => r119
+output 8
+load r5 => r40
+load r32 => r36
+nop
+load r41 => r129
+sub r120 , r67 => r41
+load r44 => r43
+loadI 1 => r92
+rshift r174 , r92 => r142
+output 12
+loadI 1 => r95
+lshift r163,r95 => r96
+add r19 , r142 => r45
+loadI 40 => r132
+store r189 => r2
+load r69 => r131
+loadI 4 => r125   // comment here
+loadI 44 => r90
+mult r15,r153 => r52
+sub r18 , r129 => r62
+loadI 32 => r163
+add r24,r41 => r143
+load r55 => r132
+loadI 0 => r0
+loadI 6 => r14   // comment here
+load r2 => r36
+loadI 2 => r106
+rshift r41 , r106 => r44
+add r43 , r96 => r122
+loadI 2 => r20
+lshift r55,r20 => r167
+nop
+load r119 => r85
+output 32
+loadI 2 => r175
+rshift r153,r175 => r67
+nop
+output 0
+output 24
+store r190 => r18
+sub r177 , r67 => r161
+store r68 => r90
+add r163 , r149 => r111
+output 24
+load r163 => r43
+loadI 10 => r27
+loadI 16 => r7
+load r31 => r188   // comment here
+output 44
+nop
+load r24 => r27
+loadI 8 => r8
+load r32 => r122
+loadI 18 => r193
+add r8, r36 => r72
+mult r110,r107 => r128
+load r120 => r105   // comment here
+add r0, r68 => r180
+loadI 18 => r23
+loadI 4 => r51   // comment here
+loadI 1 => r47
+lshift r101,r47 => r151
+loadI 0 => r72
+rshift r122, r72 => r179
+loadI 31 => r162
+load r119 => r160
+loadI 47 => r101
+output 0
+loadI 0 => r161
+lshift r68, r161 => r117
+store r73 => r0
+sub r85,r41 => r43
+store r99 => r163
+sub r10 , r38 => r77
+load r81 => r63
+load r15 => r41
+nop
+nop
+loadI 48 => r168
+loadI 27 => r77
+loadI 48 => r27
+loadI 32 => r111
+add r108 , r69 => r154
+store r125 => r148
+load r7 => r198
+load r68 => r173
+loadI 12 => r110
+loadI 40 => r102
+store r161 => r153   // comment here
+output 20
+add r192, r151 => r27
+loadI 12 => r183
+loadI 24 => r147
+mult r198 , r9 => r105
+loadI 12 => r175
+load r7 => r14
+add r149,r189 => r107
+load r163 => r67
+loadI 1 => r100
+lshift r110, r100 => r54
+store r10 => r147
+load r68 => r37
+load r175 => r105
+loadI 0 => r90
+rshift r18 , r90 => r68
+loadI 2 => r0
+lshift r185,r0 => r71
+loadI 2 => r159
+lshift r51 , r159 => r21
+loadI 3 => r77
+load r15 => r35
+loadI 0 => r53
+rshift r129,r53 => r167
+loadI 11 => r36
+sub r153, r41 => r136
+load r31 => r171
+mult r191, r162 => r177
+store r142 => r153
+sub r58 , r193 => r126
+sub r72, r41 => r127
+output 0
+loadI 1 => r119
+rshift r160,r119 => r109
+load r5 => r163
+load r120 => r156   // comment here
+store r99 => r24
+sub r73,r196 => r183
+mult r131 , r193 => r199
+output 36
+loadI 1 => r74
+rshift r140,r74 => r126
+nop
+sub r179, r143 => r84
+loadI 2 => r102
+rshift r132,r102 => r141
+loadI 4 => r76
+output 4
+output 48
+load r76 => r176
+load r69 => r10
+sub r38,r22 => r9
+output 0
+store r159 => r15
+output 20
+loadI 1 => r13
+lshift r77 , r13 => r145   // comment here
+loadI 25 => r107
+loadI 42 => r99
+loadI 2 => r21
+lshift r54, r21 => r120
+load r125 => r1   // comment here
+load r81 => r55
+loadI 28 => r4
+store r22 => r31
+store r61 => r5
+load r51 => r117
+output 4
+loadI 43 => r3
+loadI 20 => r79
+store r189 => r175
+output 56
+loadI 20 => r29
+loadI 2 => r193
+lshift r175,r193 => r85
+load r76 => r180
+load r175 => r185
+store r191 => r175
+nop
+loadI 1 => r115
+lshift r102, r115 => r176
+sub r109, r17 => r73
+output 16
+output 60
+loadI 48 => r141
+store r191 => r18
+load r8 => r181
+add r10, r43 => r138
+add r73 , r40 => r148
+output 40
+load r32 => r54
+loadI 44 => r179
+sub r41,r187 => r126
+loadI 2 => r80
+lshift r178,r80 => r7
+load r2 => r8
+output 60
+loadI 12 => r199
+store r131 => r79
+loadI 24 => r51
+loadI 56 => r142
+store r126 => r81
+output 8
+load r141 => r22
+load r168 => r46
+loadI 14 => r60
+output 44
+load r70 => r12
+loadI 1 => r37
+lshift r124, r37 => r193
+load r24 => r150
+store r122 => r2
+add r63, r180 => r97
+store r149 => r179
+output 4
+store r107 => r81
+output 16
+nop
+add r55,r189 => r115
+loadI 9 => r29
+store r175 => r69
+loadI 52 => r38
+loadI 21 => r146
+add r33, r161 => r123
+sub r71, r128 => r73
+loadI 32 => r93
+output 12
+sub r107 , r15 => r36   // comment here
+store r41 => r153
+loadI 44 => r134
+output 24
+loadI 14 => r46
+loadI 38 => r20
+store r175 => r69
+load r179 => r49
+loadI 33 => r16
+store r111 => r31
+loadI 1 => r104
+lshift r120 , r104 => r34
+loadI 44 => r93
+output 44
+loadI 2 => r91
+rshift r154,r91 => r62
+output 4
+loadI 0 => r187
+add r189 , r114 => r57
+loadI 1 => r64   // comment here
+output 24
+store r171 => r179
+loadI 12 => r113
+loadI 32 => r31
+loadI 14 => r35
+loadI 48 => r146
+store r192 => r179
+load r141 => r134   // comment here
+nop
+loadI 1 => r183
+lshift r73,r183 => r144
+store r24 => r31
+nop
+loadI 0 => r108
+add r24 , r132 => r51
+loadI 49 => r107
+add r87 , r73 => r164
+load r15 => r160
+output 12
+loadI 0 => r73
+lshift r194,r73 => r78
+loadI 32 => r152
+loadI 9 => r151
+mult r92,r171 => r73
+loadI 56 => r139
+load r179 => r98
+store r54 => r147
+mult r174, r189 => r85
+loadI 0 => r90
+rshift r33,r90 => r61
+mult r140, r191 => r14
+loadI 4 => r89
+store r113 => r125
+sub r132,r10 => r171
+loadI 33 => r156
+output 60
+load r179 => r180
+output 0
+add r160, r40 => r146
+store r21 => r139
+loadI 2 => r73
+lshift r97,r73 => r90
+loadI 0 => r82
+rshift r110,r82 => r190
+loadI 2 => r111
+rshift r180 , r111 => r96
+store r41 => r153
+load r18 => r83
+add r26 , r126 => r65
+loadI 2 => r137
+rshift r90 , r137 => r111
+store r192 => r110
+loadI 0 => r173
+add r142,r63 => r128
+output 16
+nop
+loadI 2 => r177
+rshift r109, r177 => r191
+add r11, r168 => r44
+mult r63, r125 => r161
+store r43 => r32
+add r4, r77 => r154
+nop
+loadI 0 => r105
+load r70 => r77
+loadI 12 => r3
+store r38 => r79
+output 16
+add r14 , r64 => r132
+loadI 31 => r43
+load r187 => r15
+load r141 => r82
+loadI 32 => r70
+output 8
+loadI 1 => r56
+lshift r160, r56 => r149
+load r18 => r57   // comment here
+output 20
+output 56
+load r173 => r126
+loadI 28 => r173
+loadI 0 => r62
+lshift r34, r62 => r44
+loadI 44 => r74
+loadI 0 => r166
+lshift r25,r166 => r31
+sub r33,r177 => r119
+mult r126, r174 => r87
+loadI 16 => r50
+sub r114, r163 => r90
+loadI 2 => r121
+rshift r153, r121 => r52
+load r50 => r180
+load r76 => r150
+loadI 0 => r54
+lshift r176, r54 => r192
+loadI 48 => r69
+load r199 => r37
+add r115, r55 => r198
+load r5 => r17
+loadI 0 => r49
+rshift r73,r49 => r183
+loadI 1 => r103
+lshift r58 , r103 => r198
+output 16
+loadI 42 => r93
+output 0
+load r153 => r102
+load r18 => r74
+output 28
+loadI 27 => r10
+loadI 1 => r141
+lshift r35 , r141 => r161
+load r153 => r145
+loadI 1 => r147
+lshift r8, r147 => r0
+store r141 => r168   // comment here
+output 4
+load r81 => r81
+output 8
+store r145 => r105
+add r41,r52 => r113
+store r1 => r89
+loadI 16 => r178
+loadI 35 => r179
+sub r67, r63 => r63
+add r67, r79 => r79
+store r23 => r50
+loadI 8 => r131
+mult r81, r17 => r181
+loadI 35 => r161
+output 16
+loadI 2 => r29
+lshift r43, r29 => r74
+loadI 19 => r15
+store r198 => r142
+loadI 2 => r43
+rshift r43, r43 => r18   // comment here
+nop
+loadI 32 => r183
+loadI 1 => r139
+lshift r151,r139 => r2
+load r183 => r157
+load r175 => r167
+loadI 48 => r7
+sub r29, r110 => r174
+store r134 => r76
+mult r152, r3 => r94
+mult r102, r107 => r10
+load r142 => r12
+loadI 2 => r76
+lshift r57 , r76 => r148
+load r125 => r35
+nop
+loadI 24 => r112
+loadI 32 => r156
+add r77,r134 => r107
+loadI 10 => r45
+loadI 36 => r144
+loadI 27 => r82
+output 16
+nop
+store r93 => r5
+load r4 => r144
+nop
+load r4 => r87
+load r168 => r56
+add r4,r54 => r148
+output 44
+load r38 => r66
+loadI 7 => r51
+store r99 => r7
+load r173 => r58
+loadI 47 => r146
+load r32 => r104
+store r90 => r153
+add r1 , r104 => r184
+store r67 => r38
+nop
+store r63 => r153
+loadI 4 => r60   // comment here
+load r168 => r117
+store r0 => r187
+load r168 => r144
+store r10 => r142
+store r34 => r112
+loadI 33 => r95
+store r93 => r5
+loadI 0 => r172
+rshift r96,r172 => r65
+loadI 1 => r5
+rshift r37, r5 => r28
+loadI 43 => r141
+store r161 => r183
+load r4 => r113   // comment here
+sub r82, r172 => r123
+loadI 41 => r46
+loadI 0 => r100
+lshift r33 , r100 => r156
+sub r21 , r8 => r150   // comment here
+loadI 21 => r92
+mult r55 , r149 => r85
+loadI 4 => r63
+store r100 => r125
+loadI 16 => r67
+loadI 6 => r143
+store r191 => r112
+sub r58,r146 => r77
+sub r146, r128 => r85
+load r105 => r128
+loadI 9 => r60
+loadI 56 => r171
+store r131 => r168
+store r46 => r4
+loadI 19 => r20
+nop
+store r180 => r89
+sub r105, r77 => r139
+load r175 => r180   // comment here
+loadI 36 => r114
+load r110 => r61
+nop
+loadI 16 => r147   // comment here
+add r185,r124 => r54
+store r144 => r112
+load r142 => r44
+add r8,r7 => r198
+loadI 2 => r81
+lshift r26,r81 => r167
+load r171 => r84
+loadI 8 => r53
+mult r7 , r54 => r58
+store r123 => r105
+loadI 2 => r92
+rshift r147,r92 => r135
+loadI 44 => r121
+load r187 => r193
+output 16
+sub r43,r111 => r155
+output 20
+sub r17 , r117 => r54
+output 48
+add r140 , r174 => r16
+load r38 => r15
+loadI 0 => r64
+lshift r167 , r64 => r67
+loadI 52 => r52
+loadI 1 => r122
+lshift r132, r122 => r192
+mult r137, r144 => r63
+load r173 => r54
+output 24
+store r69 => r32
+output 36
+store r144 => r125
+loadI 0 => r192
+rshift r73 , r192 => r118
+loadI 0 => r149
+lshift r8 , r149 => r51
+loadI 36 => r129
+loadI 40 => r5
+loadI 33 => r124
+loadI 40 => r175
+add r198, r36 => r127
+loadI 17 => r57
+loadI 4 => r68
+loadI 17 => r142   // comment here
+load r114 => r116
+loadI 1 => r108
+lshift r175,r108 => r138
+loadI 52 => r194
+output 0
+mult r164 , r180 => r50
+store r153 => r68
+loadI 43 => r177
+mult r81 , r82 => r121
+mult r122 , r78 => r60
+output 44
+loadI 2 => r18
+rshift r183 , r18 => r139
+load r199 => r67
+mult r20, r10 => r146
+loadI 33 => r193
+loadI 20 => r93
+load r168 => r163
+output 4
+loadI 2 => r39
+lshift r142,r39 => r64
+loadI 2 => r115
+rshift r171,r115 => r22
+nop
+loadI 0 => r38
+lshift r41, r38 => r174
+sub r146,r139 => r87
+load r70 => r146
+load r187 => r183
+output 32
+store r114 => r24
+output 24
+nop
+store r49 => r32
+loadI 52 => r192
+load r199 => r90
+store r110 => r125
+output 44
+loadI 56 => r18
+loadI 2 => r151
+lshift r140,r151 => r118
+loadI 1 => r112
+lshift r164, r112 => r125
+store r7 => r194
+add r163,r129 => r84
+loadI 36 => r56
+loadI 13 => r22
+loadI 40 => r174
+loadI 37 => r176
+add r13, r85 => r85
+loadI 32 => r137
+mult r124,r73 => r130
+sub r78,r150 => r138
+loadI 23 => r53
+load r192 => r149
+output 40
+output 4
+loadI 40 => r17   // comment here
+loadI 24 => r112
+load r171 => r103
+sub r142 , r188 => r111
+loadI 31 => r18
+output 20
+load r93 => r191
+loadI 24 => r40
+sub r5, r38 => r106
+loadI 2 => r14
+lshift r62, r14 => r34
+sub r87 , r29 => r180
+mult r176, r63 => r54
+load r199 => r100
+sub r127 , r20 => r167
+loadI 27 => r38
+add r73, r142 => r168
+output 8
+loadI 1 => r124
+lshift r185 , r124 => r77
+store r172 => r199
+store r67 => r17
+loadI 1 => r0
+rshift r130, r0 => r49
+loadI 60 => r85
+store r53 => r4
+add r57 , r0 => r24
+store r180 => r93
+loadI 26 => r131
+loadI 4 => r147
+load r199 => r92
+output 40   // comment here
+load r5 => r77
+loadI 60 => r61
+mult r18 , r72 => r41
+mult r33 , r35 => r103
+loadI 34 => r61
+output 0
+loadI 44 => r179
+loadI 32 => r43
+loadI 2 => r74
+rshift r85, r74 => r30
+loadI 32 => r62
+loadI 40 => r62
+loadI 11 => r158
+loadI 1 => r2
+lshift r84,r2 => r105   // comment here
+store r150 => r4
+loadI 13 => r88
+loadI 4 => r84
+store r189 => r68
+store r17 => r153
+loadI 44 => r160
+loadI 37 => r183
+nop
+store r111 => r4
+output 4
+store r112 => r43
+loadI 2 => r136
+rshift r126, r136 => r161
+store r43 => r43
+store r33 => r89
+load r68 => r147
+load r112 => r12
+store r92 => r43
+output 48
+loadI 21 => r167
+output 52
+loadI 7 => r125
+loadI 0 => r117
+lshift r103 , r117 => r85
+loadI 1 => r74
+lshift r77,r74 => r22
+output 52
+store r132 => r110
+loadI 40 => r47
+sub r123,r106 => r100
+nop
+nop
+store r171 => r199
+loadI 28 => r44
+store r73 => r173
+nop
+store r107 => r17
+store r15 => r173
+load r5 => r68
+loadI 1 => r167
+lshift r20,r167 => r126
+loadI 48 => r174
+store r18 => r4
+loadI 0 => r83
+output 16
+output 4
+loadI 17 => r150
+loadI 26 => r197
+add r2 , r78 => r126
+output 40
+load r47 => r12
+sub r129, r143 => r15
+mult r49,r18 => r76
+sub r67, r107 => r121
+output 48
+loadI 1 => r120
+lshift r193, r120 => r28
+load r93 => r104
+store r114 => r7
+store r83 => r194
+load r62 => r19
+loadI 0 => r161
+lshift r198,r161 => r66
+loadI 22 => r178
+sub r58 , r63 => r24
+add r13, r63 => r165
+load r43 => r30
+mult r96,r156 => r127
+loadI 33 => r36
+output 36
+add r3, r81 => r128
+load r137 => r110
+load r7 => r173
+store r122 => r199
+store r109 => r137
+output 48
+loadI 24 => r180
+add r17,r103 => r130
+output 36
+load r83 => r20
+load r153 => r31
+add r178, r41 => r195
+loadI 0 => r152
+lshift r112 , r152 => r10
+loadI 40 => r57
+sub r14,r124 => r53
+store r116 => r17
+loadI 44 => r129
+load r47 => r22
+loadI 2 => r57
+rshift r151,r57 => r14
+mult r146 , r84 => r122
+loadI 2 => r87
+rshift r0, r87 => r48
+sub r79,r143 => r4
+store r16 => r44
+loadI 18 => r193
+output 0
+loadI 41 => r3
+load r114 => r142
+loadI 44 => r161
+loadI 26 => r44
+store r126 => r174
+output 44
+add r51, r29 => r121
+mult r46,r14 => r53
+loadI 33 => r49
+store r16 => r93
+store r134 => r187   // comment here
+loadI 1 => r149   // comment here
+store r0 => r161
+loadI 4 => r146
+loadI 2 => r196
+rshift r131, r196 => r52
+output 48
+loadI 28 => r32
+load r47 => r175
+add r18, r128 => r120
+load r129 => r61
+loadI 1 => r30
+lshift r111,r30 => r153
+loadI 28 => r58
+store r51 => r199
+nop
+loadI 28 => r12
+loadI 26 => r142
+loadI 12 => r4
+output 12
+store r167 => r171
+loadI 0 => r97
+loadI 32 => r165
+load r4 => r137
+loadI 29 => r139
+loadI 20 => r190
+store r132 => r40
+load r114 => r171
+loadI 22 => r22
+loadI 6 => r61
+mult r156 , r191 => r126
+sub r129, r64 => r19
+load r129 => r54
+loadI 0 => r166
+lshift r14 , r166 => r194
+loadI 45 => r5
+load r7 => r110
+loadI 28 => r158
+loadI 1 => r76
+loadI 60 => r113
+store r54 => r112
+loadI 28 => r137
+mult r101, r128 => r87
+loadI 40 => r80
+loadI 0 => r135
+lshift r16 , r135 => r166
+output 52
+add r12,r52 => r55
+output 32
+loadI 39 => r45
+load r113 => r72
+loadI 5 => r65
+loadI 41 => r66
+load r12 => r17
+load r112 => r19
+loadI 8 => r3
+loadI 32 => r126
+loadI 1 => r65
+lshift r93,r65 => r101
+loadI 29 => r186
+store r61 => r70
+loadI 42 => r53
+load r93 => r18
+loadI 19 => r168
+loadI 4 => r36
+load r58 => r149
+loadI 16 => r3
+loadI 1 => r35
+rshift r97,r35 => r188
+loadI 28 => r169
+loadI 0 => r194
+loadI 23 => r56
+output 32
+loadI 44 => r169
+loadI 12 => r112
+store r173 => r187
+sub r27, r74 => r112
+loadI 28 => r92
+load r187 => r130
+store r14 => r12
+nop
+loadI 15 => r110
+mult r52,r67 => r21
+output 56
+loadI 6 => r115
+load r62 => r17
+nop
+loadI 32 => r2
+load r113 => r189   // comment here
+load r3 => r127
+loadI 40 => r93
+output 44
+load r137 => r58   // comment here
+add r10,r0 => r9
+loadI 40 => r49
+output 48   // comment here
+loadI 14 => r92
+loadI 0 => r159
+lshift r19,r159 => r49
+nop
+loadI 52 => r193
+add r60, r144 => r197
+store r191 => r7
+load r129 => r143
+mult r180,r116 => r30
+loadI 8 => r35
+output 4
+add r192,r145 => r104
+load r193 => r38
+loadI 0 => r111
+lshift r177,r111 => r4
+store r134 => r114
+mult r197 , r22 => r180
+loadI 2 => r150
+lshift r68 , r150 => r94
+loadI 16 => r19
+loadI 41 => r177
+loadI 2 => r18
+rshift r77, r18 => r189
+mult r18,r144 => r113
+store r188 => r80
+sub r87 , r128 => r53
+nop
+loadI 24 => r188
+store r122 => r7
+output 12   // comment here
+loadI 41 => r103
+load r43 => r147
+loadI 2 => r123
+lshift r4 , r123 => r4
+loadI 36 => r94
+load r80 => r63
+nop
+store r167 => r40
+store r0 => r137
+output 4
+loadI 32 => r136   // comment here
+store r101 => r94
+loadI 32 => r44
+store r87 => r192   // comment here
+loadI 9 => r22
+loadI 52 => r89
+output 40
+loadI 8 => r41
+load r174 => r33
+store r172 => r43
+loadI 48 => r143
+load r160 => r75
+loadI 6 => r18
+loadI 56 => r181
+loadI 30 => r23
+loadI 13 => r49
+load r192 => r192
+loadI 0 => r14
+rshift r179 , r14 => r58   // comment here
+sub r105,r58 => r176
+output 24
+nop
+loadI 40 => r15
+store r3 => r15
+mult r139, r4 => r78
+mult r185, r176 => r131
+output 28
+loadI 45 => r30
+loadI 0 => r198
+lshift r44 , r198 => r27
+loadI 2 => r171
+lshift r81,r171 => r56
+loadI 2 => r95
+lshift r92 , r95 => r114
+load r89 => r196
+load r43 => r34   // comment here
+nop
+loadI 2 => r119
+loadI 21 => r192
+loadI 45 => r100
+loadI 42 => r73
+loadI 52 => r18
+loadI 45 => r195
+loadI 12 => r62
+output 48
+nop
+loadI 2 => r51
+lshift r180 , r51 => r33
+nop
+store r53 => r160
+loadI 2 => r38
+lshift r41,r38 => r82
+store r173 => r160
+add r7, r93 => r88
+add r189,r141 => r58
+mult r102,r108 => r158
+sub r174 , r24 => r105
+load r15 => r62
+load r199 => r186
+loadI 40 => r78
+store r105 => r7
+add r150,r51 => r44
+loadI 34 => r190
+loadI 21 => r140
+sub r61, r46 => r92
+loadI 1 => r6
+loadI 4 => r17
+loadI 1 => r122
+lshift r21 , r122 => r79
+output 60
+mult r113, r73 => r146
+nop
+loadI 28 => r114
+mult r167 , r14 => r31
+loadI 1 => r151
+add r163 , r180 => r74
+sub r4, r55 => r154
+output 52
+load r187 => r106
+mult r67,r54 => r47
+sub r103, r160 => r143
+output 12
+add r45 , r141 => r5
+store r143 => r136
+output 24
+load r15 => r7
+load r160 => r154
+loadI 0 => r13
+rshift r61, r13 => r198
+output 20
+loadI 20 => r65
+loadI 46 => r51
+store r22 => r41
+loadI 0 => r125
+lshift r150, r125 => r113
+output 52
+sub r64 , r199 => r104
+loadI 22 => r41
+sub r30, r14 => r114
+load r89 => r129
+loadI 1 => r124
+lshift r112,r124 => r70
+loadI 0 => r43
+rshift r106,r43 => r18
+nop
+loadI 2 => r180
+lshift r8 , r180 => r100
+output 0   // comment here
+store r36 => r194
+store r65 => r78
+load r40 => r141
+store r20 => r199
+loadI 2 => r151
+lshift r38, r151 => r173
+output 48
+sub r189,r45 => r157
+mult r62,r171 => r5
+store r2 => r137
+loadI 32 => r65   // comment here
+store r91 => r89
+load r199 => r70
+loadI 0 => r96
+lshift r16, r96 => r19
+store r15 => r174
+loadI 12 => r111
+load r89 => r197
+sub r194 , r66 => r127
+loadI 38 => r181
+add r198, r16 => r31   // comment here
+store r10 => r78
+loadI 44 => r46
+nop
+nop
+mult r198, r188 => r123
+store r63 => r40
+loadI 41 => r89
+add r92 , r37 => r140   // comment here
+add r53 , r43 => r86
+output 4
+load r40 => r127
+add r95 , r53 => r179
+store r132 => r3
+loadI 26 => r97
+loadI 1 => r80
+rshift r100,r80 => r48
+loadI 0 => r170
+load r3 => r164
+loadI 2 => r146
+rshift r199,r146 => r125
+nop
+store r113 => r187
+loadI 37 => r106
+store r8 => r199
+loadI 12 => r96
+mult r58 , r126 => r114
+loadI 8 => r184
+mult r95 , r184 => r130
+loadI 1 => r165
+rshift r129 , r165 => r116
+loadI 0 => r191
+lshift r194,r191 => r173
+nop
+store r73 => r40
+sub r111, r33 => r129
+loadI 2 => r20
+load r46 => r20
+loadI 0 => r165
+rshift r103, r165 => r165
+sub r117,r140 => r57
+loadI 14 => r66
+nop
+nop
+loadI 0 => r54
+rshift r44,r54 => r106
+load r96 => r98
+loadI 0 => r66
+rshift r96 , r66 => r133
+sub r164,r153 => r120
+mult r191 , r129 => r127
+add r113, r73 => r28
+mult r98, r64 => r140
+loadI 36 => r52
+mult r35, r165 => r162
+output 20
+load r137 => r75
+loadI 0 => r150
+loadI 7 => r131
+loadI 6 => r28
+load r46 => r170   // comment here
+loadI 32 => r109
+load r199 => r131
+output 20   // comment here
+loadI 14 => r45
+output 32
+store r178 => r3
+add r81,r176 => r178
+store r63 => r12
+add r45 , r128 => r109
+mult r190, r57 => r141
+output 32
+loadI 12 => r38
+loadI 1 => r127
+rshift r10 , r127 => r118
+store r126 => r161
+output 0
+store r115 => r161
+loadI 0 => r121
+lshift r119 , r121 => r56
+loadI 4 => r128
+loadI 40 => r17
+add r173, r101 => r78
+output 28
+loadI 12 => r110
+sub r18, r120 => r127
+store r76 => r184
+store r123 => r137   // comment here
+loadI 45 => r133
+sub r120,r131 => r110
+loadI 28 => r119
+loadI 36 => r104
+mult r83, r28 => r84   // comment here
+loadI 0 => r21
+lshift r16 , r21 => r14
+add r151,r65 => r174
+loadI 28 => r126
+output 60
+loadI 0 => r111
+load r52 => r11
+store r96 => r93
+loadI 46 => r56
+loadI 32 => r93
+sub r18 , r114 => r23
+output 16
+add r3, r94 => r97
+loadI 5 => r10
+nop
+output 56
+load r128 => r144
+sub r156, r171 => r86
+loadI 2 => r71
+rshift r122, r71 => r128
+loadI 1 => r136
+rshift r103, r136 => r70
+store r108 => r38
+loadI 34 => r130
+add r181,r168 => r123
+loadI 45 => r115
+mult r166, r22 => r53
+mult r30, r64 => r177
+loadI 52 => r92
+mult r103,r150 => r58
+loadI 31 => r188
+loadI 16 => r124
+store r121 => r92
+mult r7, r11 => r164
+add r165,r66 => r62   // comment here
+loadI 24 => r13
+store r102 => r17
+loadI 1 => r152
+rshift r190,r152 => r5
+add r110,r134 => r29
+load r46 => r183
+loadI 14 => r172
+loadI 40 => r61
+load r17 => r164
+loadI 24 => r117
+nop
+loadI 48 => r58
+output 28
+loadI 36 => r162
+store r66 => r61
+loadI 20 => r97
+store r193 => r38
+loadI 47 => r66
+nop
+sub r137, r162 => r23
+loadI 18 => r105
+mult r142 , r129 => r130
+loadI 1 => r99
+rshift r56 , r99 => r85
+load r111 => r194
+nop
+loadI 41 => r168
+add r165, r185 => r106
+loadI 0 => r169
+lshift r129 , r169 => r170
+sub r193,r164 => r42
+loadI 40 => r96
+load r162 => r139
+loadI 20 => r44
+loadI 2 => r168
+rshift r67,r168 => r80
+loadI 7 => r123
+sub r103,r70 => r190
+store r123 => r119
+nop
+load r161 => r20
+loadI 46 => r176
+store r36 => r160
+output 0   // comment here
+output 56
+store r10 => r117
+loadI 0 => r162
+add r120, r23 => r12
+load r52 => r188
+output 56
+nop
+loadI 14 => r15
+output 60
+output 16
+loadI 1 => r56
+lshift r80 , r56 => r69
+sub r14, r111 => r11
+mult r116 , r96 => r89
+load r104 => r102
+loadI 0 => r108
+lshift r1 , r108 => r120
+output 28
+store r54 => r161
+load r97 => r72
+load r65 => r80
+loadI 16 => r77
+load r3 => r179
+add r143 , r106 => r111
+add r120 , r58 => r44
+loadI 0 => r38
+lshift r2 , r38 => r46
+loadI 12 => r121
+add r153, r111 => r113
+load r40 => r137
+output 36
+load r104 => r44
+loadI 1 => r176
+lshift r63,r176 => r39
+store r102 => r40
+output 4
+loadI 8 => r65
+loadI 56 => r0
+loadI 28 => r185
+loadI 60 => r191
+nop
+loadI 48 => r193
+loadI 1 => r173
+rshift r80 , r173 => r149
+sub r89 , r33 => r54   // comment here
+loadI 35 => r147
+loadI 52 => r175
+loadI 20 => r160
+sub r138 , r154 => r182
+loadI 0 => r164
+loadI 33 => r113
+sub r160, r121 => r73
+loadI 2 => r23
+rshift r176, r23 => r164
+mult r16 , r35 => r162
+output 12
+loadI 0 => r111
+lshift r56, r111 => r97
+load r0 => r96
+store r36 => r36
+load r36 => r51
+loadI 2 => r39
+rshift r149, r39 => r132
+output 28
+loadI 56 => r20
+store r113 => r20
+loadI 0 => r27
+loadI 0 => r6
+lshift r100, r6 => r128
+store r14 => r104
+loadI 26 => r74
+load r94 => r12
+nop
+load r193 => r152
+loadI 24 => r109
+store r124 => r104
+load r187 => r72
+loadI 0 => r21
+rshift r54,r21 => r132
+mult r169 , r97 => r74
+loadI 28 => r131
+output 32
+output 24
+sub r116 , r33 => r65
+loadI 0 => r118
+rshift r61 , r118 => r182
+load r161 => r47
+load r191 => r11
+nop
+load r184 => r95
+load r124 => r103
+loadI 2 => r36
+lshift r51,r36 => r199
+add r35 , r180 => r183
+store r92 => r109
+mult r131 , r158 => r47
+loadI 33 => r39
+add r137 , r107 => r36
+nop
+nop
+loadI 0 => r52
+loadI 48 => r119
+loadI 28 => r58   // comment here
+loadI 8 => r181
+add r55 , r36 => r31   // comment here
+store r14 => r175
+store r128 => r83
+sub r151 , r188 => r181
+load r184 => r153
+loadI 20 => r74   // comment here
+loadI 1 => r85
+rshift r142 , r85 => r180
+load r77 => r70
+store r111 => r104
+store r36 => r184
+loadI 16 => r29
+loadI 40 => r170
+add r115,r99 => r44
+add r78, r58 => r129
+store r192 => r160
+loadI 2 => r14
+lshift r171, r14 => r129
+load r27 => r51
+nop   // comment here
+store r144 => r27
+nop
+load r58 => r3
+load r104 => r158
+loadI 0 => r125
+rshift r3 , r125 => r103
+store r23 => r20
+loadI 36 => r153   // comment here
+output 32
+loadI 15 => r121
+add r84,r34 => r84
+output 48
+load r93 => r110
+load r184 => r159
+loadI 0 => r170
+rshift r22,r170 => r37
+store r87 => r175   // comment here
+load r20 => r67
+sub r193 , r117 => r157
+store r41 => r27
+loadI 0 => r114
+lshift r53,r114 => r142
+loadI 3 => r69
+loadI 8 => r0
+loadI 36 => r97
+loadI 29 => r31
+loadI 16 => r30
+loadI 32 => r0
+store r111 => r131
+nop
+store r77 => r150
+sub r142,r70 => r70
+loadI 9 => r157
+load r94 => r51
+store r161 => r58
+loadI 0 => r113
+lshift r74,r113 => r23
+loadI 0 => r53
+load r161 => r32
+load r27 => r160
+loadI 52 => r87
+store r63 => r175
+loadI 12 => r107
+mult r51,r78 => r77
+loadI 56 => r30
+mult r104 , r96 => r59
+load r87 => r110
+loadI 21 => r97
+loadI 5 => r162
+load r0 => r105
+loadI 2 => r198
+lshift r66 , r198 => r122
+loadI 1 => r65
+nop   // comment here
+store r66 => r87
+output 52
+loadI 2 => r22
+lshift r180,r22 => r56
+loadI 1 => r93
+rshift r127, r93 => r27
+loadI 1 => r169
+rshift r5,r169 => r146
+loadI 34 => r160
+loadI 1 => r187
+lshift r103,r187 => r9
+loadI 3 => r13
+store r50 => r107
+store r39 => r117
+loadI 24 => r187
+loadI 0 => r17
+rshift r112,r17 => r141
+loadI 40 => r11   // comment here
+store r127 => r109
+nop
+sub r140, r57 => r194
+load r61 => r195
+loadI 34 => r92
+store r121 => r175
+load r124 => r3   // comment here
+load r58 => r161
+sub r53, r198 => r76
+loadI 1 => r178
+lshift r32, r178 => r21
+store r118 => r109
+load r29 => r80
+loadI 1 => r9
+rshift r70, r9 => r197
+store r85 => r30
+load r184 => r162
+store r105 => r131
+sub r73,r49 => r101   // comment here
+sub r162,r109 => r44
+loadI 6 => r192
+store r54 => r0
+mult r103 , r31 => r65
+nop   // comment here
+mult r82,r122 => r67   // comment here
+store r138 => r124   // comment here
+output 32
+mult r180, r128 => r130
+loadI 44 => r114
+store r68 => r53
+output 32
+mult r105 , r87 => r66
+loadI 2 => r63
+sub r111,r53 => r89
+loadI 27 => r170
+add r31,r18 => r21
+loadI 0 => r161
+rshift r191 , r161 => r132
+mult r180,r160 => r195
+output 40
+loadI 60 => r197
+loadI 7 => r139
+sub r36, r66 => r38
+load r29 => r81
+loadI 2 => r26
+load r107 => r118
+store r118 => r124
+loadI 44 => r45
+add r71 , r193 => r180   // comment here
+loadI 28 => r134
+load r104 => r70
+loadI 1 => r10
+rshift r16,r10 => r34
+store r144 => r150
+output 32
+add r47, r192 => r178
+nop
+load r11 => r187
+sub r130, r128 => r44
+sub r97,r73 => r71
+loadI 12 => r165
+loadI 0 => r55
+rshift r64, r55 => r4
+add r164, r34 => r46
+sub r143 , r17 => r192
+loadI 49 => r174
+loadI 21 => r142
+loadI 12 => r53
+store r80 => r29
+loadI 1 => r167
+rshift r183, r167 => r150
+store r196 => r131
+loadI 2 => r61
+lshift r32,r61 => r132
+loadI 8 => r66
+add r104, r58 => r114
+sub r67, r116 => r38
+loadI 2 => r60
+lshift r12,r60 => r61
+load r197 => r120
+loadI 23 => r47
+load r87 => r183
+output 4
+loadI 42 => r185
+store r47 => r197
+load r40 => r107
+add r92,r178 => r112
+output 8
+store r89 => r52
+output 8
+load r94 => r64
+load r53 => r128
+loadI 24 => r31
+loadI 1 => r68
+rshift r199 , r68 => r149
+store r90 => r184
+loadI 1 => r49
+rshift r54, r49 => r33
+loadI 60 => r194
+loadI 27 => r93
+load r52 => r134
+loadI 8 => r69
+loadI 0 => r152
+lshift r190, r152 => r35
+nop
+loadI 0 => r66
+lshift r183, r66 => r54
+load r58 => r153
+mult r129 , r121 => r178
+load r94 => r146   // comment here
+loadI 5 => r66
+load r175 => r49
+nop
+add r14, r92 => r196
+store r31 => r31
+loadI 38 => r50
+load r117 => r70
+loadI 48 => r199
+loadI 32 => r111
+loadI 33 => r161
+loadI 1 => r28
+loadI 1 => r186
+lshift r67,r186 => r148
+add r124, r62 => r36
+store r40 => r184
+output 12
+loadI 34 => r104
+sub r19,r148 => r114
+sub r119, r12 => r141
+store r173 => r193
+output 12
+loadI 2 => r65
+rshift r8, r65 => r24
+loadI 0 => r25
+lshift r189 , r25 => r46
+mult r74 , r19 => r37
+load r191 => r88
+loadI 4 => r116
+loadI 1 => r14
+rshift r43 , r14 => r182
+load r191 => r194
+load r109 => r70
+loadI 44 => r78
+nop   // comment here
+store r50 => r29
+loadI 0 => r23
+lshift r44, r23 => r63
+nop
+load r111 => r177   // comment here
+loadI 28 => r57
+output 48
+store r185 => r52
+store r94 => r53
+store r29 => r40
+loadI 0 => r111
+lshift r58 , r111 => r175
+load r116 => r169
+nop   // comment here
+output 60
+load r40 => r86
+store r45 => r20
+loadI 12 => r126
+loadI 32 => r102
+load r131 => r137
+load r131 => r148
+load r191 => r124
+nop
+store r78 => r193
+sub r72, r33 => r170
+loadI 48 => r56
+loadI 48 => r135
+loadI 1 => r120
+rshift r161,r120 => r118
+loadI 0 => r157
+store r123 => r30
+loadI 0 => r84
+rshift r118,r84 => r148
+add r24,r174 => r183
+loadI 4 => r5
+nop
+loadI 44 => r128
+mult r150, r123 => r136
+loadI 2 => r18
+rshift r23 , r18 => r142
+output 32
+store r56 => r31   // comment here
+add r5, r191 => r148
+store r168 => r135
+loadI 0 => r25
+rshift r100 , r25 => r19
+store r111 => r135
+nop
+mult r102,r36 => r186
+store r128 => r126
+store r153 => r109
+loadI 3 => r137
+output 56
+loadI 0 => r49
+rshift r84, r49 => r174
+sub r150 , r43 => r151
+loadI 1 => r1
+add r73, r146 => r67
+loadI 8 => r115
+loadI 56 => r58
+loadI 60 => r111
+store r4 => r157
+store r111 => r20
+load r56 => r143
+loadI 44 => r191
+loadI 30 => r173
+sub r192, r38 => r127
+add r197,r170 => r40
+load r53 => r63
+store r97 => r126
+sub r177,r81 => r88
+loadI 2 => r161
+lshift r34, r161 => r119
+load r135 => r48   // comment here
+sub r173,r195 => r105
+loadI 0 => r67
+rshift r98, r67 => r199
+nop
+store r14 => r193
+loadI 6 => r181   // comment here
+nop
+store r65 => r126
+store r65 => r83
+store r92 => r52   // comment here
+store r111 => r116
+load r102 => r136
+mult r154, r162 => r197
+store r113 => r83
+loadI 8 => r185
+loadI 28 => r3
+loadI 0 => r175
+loadI 2 => r135
+rshift r93, r135 => r162
+store r29 => r53
+add r53, r47 => r170
+store r191 => r29
+store r78 => r57
+sub r124 , r18 => r86
+loadI 8 => r145
+add r126, r160 => r183
+load r30 => r9
+store r149 => r53
+mult r57,r199 => r164
+output 20
+nop
+output 24
+loadI 2 => r148
+rshift r48,r148 => r141
+store r15 => r191
+loadI 1 => r168
+loadI 48 => r138
+mult r144,r167 => r34
+sub r52 , r105 => r79
+load r53 => r20
+sub r84 , r67 => r31
+nop   // comment here
+loadI 40 => r138
+store r153 => r45
+loadI 19 => r146
+store r180 => r117
+loadI 24 => r97
+load r111 => r59
+loadI 0 => r41
+lshift r54, r41 => r71
+load r53 => r126
+loadI 48 => r61
+mult r137, r173 => r22
+output 0   // comment here
+loadI 48 => r144
+store r76 => r11
+nop
+store r158 => r3
+store r22 => r131
+store r137 => r94
+loadI 28 => r145
+add r10 , r78 => r105
+loadI 2 => r126
+lshift r54,r126 => r11
+loadI 1 => r78
+lshift r181,r78 => r26
+loadI 44 => r43
+mult r189,r64 => r34   // comment here
+load r115 => r72
+store r176 => r56
+store r74 => r83
+loadI 40 => r94
+nop
+load r94 => r164
+store r121 => r45
+store r164 => r109
+load r102 => r95
+loadI 1 => r51
+lshift r23, r51 => r132
+loadI 1 => r53
+lshift r103,r53 => r19
+load r191 => r18
+output 44
+loadI 30 => r20
+output 60
+store r137 => r115
+output 16
+add r143 , r150 => r67
+store r192 => r116
+loadI 3 => r74
+load r61 => r61
+load r43 => r149
+loadI 44 => r2
+store r175 => r2
+nop
+loadI 2 => r199
+lshift r120, r199 => r29
+nop
+output 20
+loadI 0 => r47
+rshift r18,r47 => r71   // comment here
+load r184 => r16
+sub r93, r131 => r58   // comment here
+loadI 33 => r19
+store r15 => r193
+loadI 0 => r83
+lshift r22 , r83 => r83
+mult r34 , r2 => r67
+nop
+output 12
+store r131 => r43
+loadI 24 => r125
+loadI 44 => r34   // comment here
+loadI 32 => r44
+output 12
+output 0
+loadI 33 => r107   // comment here
+loadI 5 => r45
+loadI 1 => r91
+lshift r11 , r91 => r8
+loadI 23 => r115
+loadI 0 => r108
+lshift r118 , r108 => r13
+load r193 => r182
+output 32
+load r125 => r119
+loadI 0 => r29
+loadI 15 => r195
+mult r41,r135 => r63
+load r193 => r6
+load r87 => r157
+load r0 => r96
+store r184 => r145
+loadI 2 => r55
+load r56 => r124
+output 60   // comment here
+add r20,r196 => r124   // comment here
+sub r79 , r69 => r4
+sub r85, r41 => r100
+add r136, r68 => r128   // comment here
+add r26,r109 => r11
+output 20
+store r79 => r145
+nop
+load r0 => r148
+loadI 49 => r16
+output 12
+mult r74, r20 => r181
+store r53 => r191
+loadI 23 => r148
+loadI 34 => r180
+loadI 36 => r138
+mult r73 , r100 => r182
+loadI 48 => r123
+add r58, r46 => r78
+mult r10,r182 => r158
+load r111 => r149
+load r117 => r169
+output 56
+loadI 1 => r172
+rshift r137, r172 => r97
+add r142,r113 => r40
+add r183 , r3 => r154
+loadI 1 => r2
+rshift r198,r2 => r94
+store r34 => r175
+loadI 1 => r13
+rshift r111 , r13 => r18
+loadI 28 => r171
+loadI 44 => r5
+loadI 1 => r25
+rshift r128, r25 => r74
+loadI 23 => r118
+output 4
+load r131 => r17
+load r109 => r99
+mult r0,r126 => r139
+store r56 => r3
+load r111 => r19
+store r131 => r185
+loadI 3 => r147
+loadI 1 => r194
+rshift r4,r194 => r34
+loadI 1 => r17
+rshift r20 , r17 => r123
+loadI 1 => r15
+rshift r194 , r15 => r83
+output 44
+add r113,r57 => r161
+store r129 => r3
+load r0 => r52
+loadI 1 => r15
+lshift r114 , r15 => r35   // comment here
+load r191 => r66
+loadI 52 => r118
+store r142 => r87
+loadI 22 => r33
+mult r20,r61 => r46
+loadI 17 => r137
+mult r146 , r102 => r116
+store r92 => r44
+loadI 2 => r47
+lshift r109 , r47 => r46
+loadI 11 => r59
+store r198 => r171
+loadI 27 => r18
+store r114 => r145
+store r72 => r3
+loadI 23 => r102
+nop
+loadI 28 => r32
+nop
+output 52   // comment here
+loadI 39 => r95
+sub r158 , r27 => r37
+add r116 , r140 => r147
+loadI 0 => r10
+rshift r5 , r10 => r53
+store r152 => r184
+output 24
+sub r160 , r29 => r55
+loadI 2 => r28
+rshift r124,r28 => r121
+loadI 2 => r177
+rshift r2, r177 => r141
+store r128 => r56
+loadI 24 => r168
+loadI 4 => r170
+output 0
+store r142 => r30
+loadI 33 => r143
+loadI 0 => r121
+lshift r153, r121 => r55
+loadI 4 => r148
+loadI 8 => r176
+nop
+load r111 => r94
+store r85 => r32
+add r8 , r119 => r86
+load r148 => r159
+loadI 2 => r167
+lshift r146, r167 => r159   // comment here
+loadI 33 => r118
+loadI 16 => r151
+store r63 => r185   // comment here
+loadI 1 => r106
+rshift r44,r106 => r47
+store r61 => r170
+load r117 => r139
+loadI 2 => r138
+rshift r103, r138 => r153
+sub r128, r177 => r120
+load r170 => r61
+loadI 1 => r107
+lshift r159,r107 => r57
+loadI 1 => r89
+lshift r126,r89 => r139
+loadI 44 => r16
+output 16   // comment here
+loadI 1 => r170
+rshift r12,r170 => r48
+store r85 => r0
+loadI 56 => r153
+store r91 => r29
+load r109 => r105
+store r102 => r16
+mult r98 , r44 => r143   // comment here
+add r64,r19 => r67
+store r199 => r191
+store r92 => r193
+store r194 => r171
+load r16 => r33
+loadI 24 => r195
+loadI 40 => r31
+mult r18,r55 => r28
+add r12, r53 => r16
+sub r52, r84 => r31
+add r167,r162 => r196
+store r142 => r117
+sub r58 , r22 => r151
+sub r53, r89 => r4
+add r68 , r26 => r122
+store r96 => r117
+output 32
+loadI 23 => r119
+loadI 0 => r68
+store r85 => r68
+nop
+store r70 => r43
+loadI 19 => r127
+loadI 4 => r102
+add r128,r94 => r49
+output 40
+store r189 => r32
+loadI 0 => r126
+rshift r50 , r126 => r86
+loadI 42 => r163
+output 36
+loadI 36 => r119
+store r176 => r184
+store r41 => r119
+output 44
+load r125 => r88
+loadI 26 => r1
+store r51 => r30
+load r131 => r192
+loadI 0 => r10
+rshift r180, r10 => r148
+sub r125 , r177 => r112
+loadI 4 => r121
+load r87 => r191
+store r61 => r119
+load r184 => r157
+loadI 2 => r79
+rshift r128,r79 => r107
+output 12
+nop
+add r39 , r21 => r94
+load r117 => r27
+loadI 0 => r116
+rshift r4 , r116 => r137
+mult r54, r31 => r162
+loadI 44 => r61   // comment here
+output 40
+add r144, r52 => r128
+store r144 => r29
+store r174 => r125
+loadI 4 => r178
+sub r183, r167 => r76
+loadI 44 => r11
+output 4
+sub r61 , r199 => r75
+sub r21 , r111 => r167
+loadI 49 => r86
+loadI 32 => r152
+sub r146 , r160 => r100
+store r70 => r109
+store r65 => r153
+output 56
+add r71 , r140 => r30
+mult r87,r71 => r75
+store r111 => r3
+output 20
+loadI 2 => r81
+lshift r44,r81 => r36
+mult r137 , r20 => r194
+loadI 1 => r45
+rshift r1, r45 => r35
+sub r105, r109 => r126
+load r165 => r63
+loadI 24 => r70
+output 36
+loadI 0 => r103
+loadI 40 => r72
+loadI 49 => r151
+store r104 => r185
+loadI 13 => r141
+loadI 8 => r22
+loadI 19 => r97
+store r161 => r171
+loadI 32 => r140
+nop
+load r165 => r39
+store r35 => r152
+store r73 => r184
+mult r47, r89 => r2
+output 44
+loadI 41 => r106
+loadI 1 => r140
+lshift r131, r140 => r105
+sub r24 , r151 => r55
+store r9 => r56
+store r123 => r119
+nop
+load r195 => r28   // comment here
+loadI 48 => r77
+load r56 => r37
+load r175 => r23
+store r11 => r44
+loadI 0 => r198
+lshift r93 , r198 => r3
+output 36
+load r109 => r130
+output 40
+store r69 => r175
+loadI 35 => r89
+add r121, r119 => r15
+output 20
+loadI 0 => r61
+rshift r12, r61 => r133
+loadI 60 => r10
+store r45 => r0
+loadI 1 => r141
+loadI 16 => r138
+load r29 => r180
+loadI 0 => r100
+lshift r125, r100 => r107
+loadI 1 => r71
+rshift r30, r71 => r188
+store r144 => r145
+loadI 19 => r49
+store r22 => r184
+loadI 0 => r114
+rshift r32, r114 => r8
+load r153 => r38   // comment here
+loadI 43 => r101
+nop
+loadI 48 => r47
+loadI 0 => r31
+lshift r98 , r31 => r19
+loadI 60 => r122
+output 56
+loadI 4 => r79
+nop
+store r0 => r111
+nop
+loadI 1 => r124
+rshift r153,r124 => r195
+load r43 => r33
+load r131 => r46
+output 16
+loadI 0 => r151
+rshift r67 , r151 => r60
+store r11 => r87
+mult r41,r46 => r125
+output 20
+store r165 => r79
+store r119 => r165
+loadI 48 => r125
+loadI 33 => r178
+load r117 => r111
+sub r90,r23 => r68
+output 0
+loadI 6 => r173
+load r103 => r63
+loadI 20 => r123
+loadI 37 => r188
+add r74, r48 => r120
+nop
+sub r111 , r49 => r119
+output 24
+add r134, r126 => r27
+loadI 42 => r6
+loadI 40 => r152
+mult r98, r39 => r181
+output 28
+load r165 => r38
+store r127 => r29
+load r56 => r115
+output 52
+store r61 => r165
+loadI 24 => r99
+loadI 21 => r70
+loadI 16 => r181
+loadI 42 => r70
+mult r92 , r73 => r194
+output 8
+output 0
+output 28
+sub r176,r109 => r0   // comment here
+nop
+loadI 21 => r167
+store r39 => r152
+load r181 => r110
+store r92 => r145
+store r105 => r22
+loadI 3 => r56
+store r154 => r184
+load r10 => r188
+add r113 , r141 => r134
+store r89 => r175
+loadI 2 => r58
+lshift r107 , r58 => r24
+output 32
+load r117 => r74
+load r32 => r81   // comment here
+loadI 9 => r86
+mult r37,r136 => r176
+store r135 => r103
+load r153 => r137
+output 44
+loadI 0 => r125
+loadI 60 => r150
+loadI 40 => r118
+loadI 1 => r121
+lshift r68 , r121 => r18   // comment here
+load r87 => r101
+loadI 18 => r43
+add r146, r140 => r4
+sub r114,r161 => r93
+nop
+sub r75, r142 => r38
+loadI 4 => r42
+loadI 12 => r158
+store r74 => r44   // comment here
+store r68 => r123
+load r185 => r100
+loadI 56 => r183
+store r120 => r131
+loadI 44 => r67
+store r77 => r42
+nop
+add r130,r0 => r79
+loadI 36 => r9   // comment here
+add r164,r61 => r172
+loadI 30 => r145
+loadI 60 => r108
+load r9 => r188
+load r165 => r96
+store r71 => r193
+store r142 => r32
+output 4
+loadI 0 => r146
+rshift r69 , r146 => r92
+loadI 12 => r114
+sub r25,r180 => r155
+nop
+store r111 => r153
+nop
+loadI 40 => r197
+load r150 => r126
+store r68 => r165
+add r137, r180 => r165
+output 48
+loadI 1 => r62
+lshift r123,r62 => r107
+loadI 0 => r15
+lshift r161 , r15 => r20
+load r197 => r195
+store r5 => r108
+store r54 => r109
+sub r129 , r31 => r91
+loadI 32 => r138
+nop
+loadI 4 => r164
+loadI 43 => r178
+load r9 => r2
+loadI 1 => r60
+rshift r33, r60 => r152   // comment here
+load r9 => r146
+store r31 => r138
+add r133,r62 => r77
+output 20
+loadI 22 => r19
+mult r8,r58 => r148
+loadI 40 => r12
+output 12
+add r79 , r161 => r8
+loadI 1 => r101
+rshift r137 , r101 => r103
+nop
+loadI 2 => r90
+lshift r149 , r90 => r48
+loadI 0 => r62
+rshift r66,r62 => r159
+loadI 14 => r162
+load r42 => r71
+sub r83,r184 => r160
+sub r163,r19 => r178
+load r153 => r176
+loadI 1 => r126
+lshift r94 , r126 => r72
+nop
+loadI 35 => r92
+loadI 60 => r152
+add r142 , r160 => r52
+loadI 32 => r180
+loadI 1 => r171
+loadI 12 => r40
+store r93 => r22
+load r131 => r85
+load r9 => r56
+loadI 20 => r44
+add r191,r105 => r64
+loadI 10 => r38
+store r102 => r175
+nop
+output 8
+store r163 => r152
+load r175 => r84
+loadI 1 => r33
+rshift r10,r33 => r12
+loadI 0 => r79
+rshift r159 , r79 => r90
+load r138 => r132
+mult r28 , r36 => r107
+loadI 16 => r75
+loadI 1 => r142
+lshift r122,r142 => r27
+loadI 1 => r114
+sub r90,r19 => r24
+add r41,r90 => r97
+store r136 => r164
+loadI 2 => r88
+rshift r29, r88 => r83   // comment here
+load r117 => r165
+output 16
+store r193 => r29
+load r185 => r80
+load r42 => r158
+loadI 2 => r77
+rshift r80 , r77 => r122
+sub r138, r65 => r139
+loadI 44 => r108
+loadI 47 => r102
+add r126 , r165 => r20
+loadI 23 => r29
+store r20 => r108
+output 36
+store r58 => r123
+loadI 0 => r93
+lshift r119 , r93 => r42
+loadI 21 => r121
+loadI 24 => r186
+load r183 => r100
+loadI 28 => r122
+add r178 , r118 => r134
+nop
+load r152 => r116
+loadI 1 => r20
+lshift r34,r20 => r194
+add r128 , r30 => r88
+sub r90 , r160 => r184
+load r164 => r172
+add r192,r19 => r194
+load r108 => r77
+mult r196,r53 => r86
+loadI 16 => r118
+loadI 2 => r94
+rshift r96,r94 => r150
+output 12
+loadI 1 => r182
+lshift r143, r182 => r106
+output 20
+output 28
+loadI 49 => r68
+nop
+nop
+store r85 => r10
+load r75 => r106
+loadI 9 => r108
+loadI 60 => r3
+store r11 => r9
+loadI 49 => r84
+store r132 => r87
+loadI 2 => r20
+lshift r42,r20 => r51
+loadI 2 => r84
+lshift r124,r84 => r137
+output 12
+loadI 1 => r183
+lshift r183, r183 => r113
+output 8
+mult r90,r136 => r16
+store r140 => r32
+nop
+load r175 => r192
+sub r95, r76 => r181
+loadI 1 => r194
+rshift r148 , r194 => r67
+loadI 4 => r45
+loadI 0 => r30
+rshift r146, r30 => r180
+output 12
+nop
+store r20 => r175
+store r96 => r22
+nop
+loadI 2 => r176
+lshift r12, r176 => r145
+loadI 46 => r87
+loadI 2 => r163
+lshift r36,r163 => r84
+sub r18 , r193 => r134
+loadI 1 => r16
+lshift r131,r16 => r45
+loadI 0 => r7
+lshift r180 , r7 => r6
+loadI 1 => r0
+rshift r105 , r0 => r102
+loadI 32 => r39
+store r104 => r22
+load r186 => r195
+nop
+loadI 60 => r72
+add r87,r55 => r159
+loadI 49 => r96
+sub r61,r69 => r72
+store r176 => r131
+loadI 52 => r183
+add r54 , r10 => r88
+mult r183,r31 => r177
+mult r38,r158 => r186
+load r9 => r138
+nop
+sub r142, r186 => r87
+output 28
+load r122 => r34
+store r170 => r3
+sub r0,r124 => r82
+store r47 => r39
+load r99 => r84
+output 52
+mult r45 , r77 => r88
+sub r61,r28 => r102
+load r22 => r155
+add r43,r41 => r3
+loadI 2 => r26
+lshift r183,r26 => r0
+loadI 3 => r82
+loadI 28 => r165
+loadI 27 => r75
+loadI 17 => r7
+store r138 => r175
+load r117 => r118
+load r9 => r27
+mult r74,r58 => r197
+output 8
+load r193 => r45
+store r114 => r185
+load r122 => r109
+loadI 4 => r180
+store r66 => r185
+store r12 => r32
+add r125,r113 => r104
+loadI 23 => r38
+output 16
+store r35 => r152
+loadI 47 => r179
+loadI 8 => r56
+loadI 2 => r98
+lshift r102, r98 => r129
+loadI 48 => r180
+loadI 0 => r11
+lshift r152 , r11 => r194
+nop
+loadI 48 => r126
+loadI 1 => r53
+lshift r39 , r53 => r107
+store r106 => r10
+sub r183,r176 => r176
+loadI 33 => r6
+loadI 2 => r66
+rshift r148, r66 => r102
+mult r179,r146 => r137
+load r185 => r154
+loadI 56 => r129
+loadI 6 => r114
+mult r147,r50 => r91
+store r123 => r164
+load r164 => r49
+mult r124,r107 => r117
+add r38 , r74 => r32
+loadI 20 => r114
+mult r149, r154 => r93
+store r139 => r193
+loadI 1 => r59
+rshift r115 , r59 => r116
+loadI 0 => r62
+rshift r20 , r62 => r65
+loadI 0 => r193
+rshift r149, r193 => r5
+loadI 11 => r78
+loadI 44 => r17
+store r132 => r40
+loadI 36 => r155
+load r22 => r3
+loadI 0 => r54
+rshift r3, r54 => r187
+loadI 2 => r55
+rshift r71,r55 => r82
+loadI 24 => r133
+loadI 28 => r113   // comment here
+load r39 => r156
+nop
+loadI 0 => r4
+lshift r74,r4 => r82
+nop
+sub r159 , r58 => r105
+store r98 => r99
+loadI 33 => r166
+store r96 => r99
+sub r116, r11 => r43
+loadI 56 => r139
+load r152 => r178
+loadI 32 => r10
+loadI 16 => r106   // comment here
+store r179 => r40
+store r152 => r183
+loadI 27 => r183
+add r22, r114 => r163
+output 16
+loadI 28 => r194
+loadI 1 => r106
+rshift r45,r106 => r162
+store r73 => r152
+mult r61 , r125 => r21
+loadI 1 => r185
+lshift r146,r185 => r19
+load r56 => r148   // comment here
+load r22 => r138
+nop
+store r47 => r194
+output 36
+load r165 => r29
+load r133 => r151
+mult r106 , r45 => r41
+store r45 => r165
+nop
+load r155 => r109
+sub r66 , r38 => r110
+load r123 => r144
+loadI 0 => r105
+rshift r116, r105 => r107
+store r118 => r39
+store r183 => r194
+store r111 => r113
+output 44
+load r155 => r92
+output 32
+loadI 44 => r113   // comment here
+load r153 => r152
+store r186 => r175
+loadI 32 => r86
+loadI 8 => r109
+nop
+output 4
+load r126 => r184
+sub r192,r88 => r29
+load r99 => r100
+store r6 => r122
+mult r7 , r135 => r70
+add r70,r74 => r77   // comment here
+loadI 1 => r115
+output 56
+load r40 => r193
+add r165,r57 => r26
+nop
+output 44
+store r119 => r139
+loadI 60 => r107
+loadI 56 => r120
+store r110 => r129
+loadI 10 => r193
+loadI 1 => r85
+rshift r152,r85 => r1
+load r17 => r54
+store r73 => r122
+nop
+load r122 => r166
+loadI 0 => r98
+lshift r138,r98 => r183
+loadI 4 => r25
+mult r98,r166 => r136
+loadI 2 => r2
+rshift r159 , r2 => r123
+mult r125, r146 => r178
+loadI 52 => r8
+output 28
+loadI 2 => r78
+rshift r114, r78 => r159
+store r118 => r10
+output 44   // comment here
+nop
+loadI 1 => r105
+lshift r126,r105 => r110
+store r62 => r17
+loadI 32 => r83
+loadI 32 => r40
+store r18 => r126
+loadI 4 => r185
+load r194 => r0
+loadI 47 => r150
+sub r24,r43 => r160
+output 8
+load r17 => r126
+store r20 => r164
+sub r153,r109 => r77
+loadI 1 => r32
+lshift r150 , r32 => r123
+loadI 49 => r168
+loadI 4 => r9
+loadI 0 => r11
+rshift r74 , r11 => r13
+loadI 1 => r66
+rshift r151 , r66 => r33
+store r120 => r56
+loadI 0 => r102
+lshift r107,r102 => r67
+loadI 45 => r99
+loadI 0 => r87
+lshift r145, r87 => r10
+add r198 , r51 => r166
+loadI 0 => r14
+rshift r105, r14 => r79
+sub r149,r162 => r40
+loadI 0 => r36
+lshift r61, r36 => r161
+output 12
+loadI 1 => r99
+rshift r111 , r99 => r111
+loadI 0 => r110
+rshift r7,r110 => r71
+output 20
+store r62 => r153
+loadI 0 => r129
+rshift r58 , r129 => r190
+loadI 0 => r93
+rshift r123, r93 => r88
+load r39 => r41
+output 8
+store r180 => r122
+store r113 => r153
+store r169 => r131
+store r47 => r185
+load r107 => r88
+loadI 27 => r107
+loadI 14 => r121
+loadI 36 => r115
+loadI 47 => r150
+loadI 2 => r189
+lshift r151,r189 => r164
+store r138 => r122
+load r17 => r157
+loadI 2 => r151
+rshift r20, r151 => r73
+store r32 => r153
+loadI 2 => r180
+lshift r35, r180 => r58
+mult r195,r22 => r199
+add r173,r92 => r4
+loadI 0 => r63
+lshift r66 , r63 => r172
+store r146 => r109
+loadI 52 => r22
+loadI 13 => r118
+output 52
+loadI 0 => r118
+lshift r187 , r118 => r73
+loadI 56 => r155
+loadI 2 => r111
+rshift r123,r111 => r86
+loadI 60 => r172
+loadI 2 => r141
+lshift r44,r141 => r128
+loadI 48 => r157
+loadI 0 => r161
+rshift r130,r161 => r151
+loadI 1 => r139
+rshift r63,r139 => r171
+loadI 1 => r144
+rshift r154, r144 => r29
+sub r121 , r137 => r171
+nop
+load r39 => r57   // comment here
+load r83 => r97
+sub r144, r8 => r87
+load r120 => r2
+store r138 => r83
+output 32
+add r132 , r124 => r175
+store r85 => r153
+output 24
+nop
+loadI 8 => r180
+sub r158,r103 => r89
+mult r168, r148 => r143
+load r39 => r133
+store r132 => r194
+load r131 => r1
+load r172 => r172
+store r115 => r22
+output 0
+loadI 56 => r31
+nop
+add r86 , r27 => r4
+output 32
+loadI 2 => r77
+rshift r177, r77 => r137
+output 52
+loadI 4 => r169
+loadI 17 => r73
+loadI 2 => r53
+rshift r170, r53 => r108
+output 24
+loadI 2 => r67
+rshift r45, r67 => r58
+nop
+mult r110 , r43 => r14
+loadI 2 => r182
+rshift r7,r182 => r20
+loadI 12 => r167
+loadI 3 => r101   // comment here
+output 24
+store r126 => r31
+loadI 20 => r129
+store r92 => r167
+loadI 8 => r10
+load r17 => r89
+nop
+store r95 => r31
+loadI 48 => r96
+sub r20 , r125 => r146
+store r22 => r153
+loadI 4 => r65
+loadI 20 => r92
+load r155 => r74
+sub r115,r96 => r176
+loadI 0 => r109
+rshift r56,r109 => r174
+loadI 1 => r152
+rshift r66,r152 => r75
+store r76 => r131
+loadI 36 => r52
+nop
+add r29 , r95 => r33
+nop
+loadI 0 => r121
+rshift r79 , r121 => r51
+store r183 => r9
+mult r148 , r170 => r125   // comment here
+store r121 => r8
+sub r18 , r130 => r111
+store r18 => r17
+load r120 => r43
+load r185 => r17
+loadI 12 => r117
+loadI 6 => r119
+load r165 => r21   // comment here
+loadI 0 => r21
+lshift r77, r21 => r36
+mult r44, r112 => r49
+loadI 8 => r115
+store r21 => r96
+load r157 => r82
+mult r62,r14 => r15
+loadI 0 => r163
+rshift r103 , r163 => r28
+store r149 => r165
+nop
+nop
+output 0
+loadI 48 => r126
+load r10 => r32
+loadI 19 => r7
+load r153 => r191
+loadI 48 => r6   // comment here
+nop
+mult r20 , r148 => r51
+store r156 => r155
+loadI 52 => r106
+loadI 56 => r106   // comment here
+loadI 26 => r186   // comment here
+store r111 => r56
+add r4,r181 => r193
+store r63 => r157
+sub r136 , r112 => r168
+mult r56 , r72 => r162
+store r108 => r120
+loadI 20 => r77
+mult r183 , r172 => r191
+loadI 32 => r110
+output 0
+load r155 => r190
+loadI 2 => r7
+lshift r119,r7 => r1
+output 52
+loadI 8 => r12
+mult r14 , r195 => r169
+mult r57, r66 => r64
+store r141 => r153
+output 4
+store r60 => r120
+loadI 0 => r125
+lshift r75, r125 => r164   // comment here
+output 20
+nop
+loadI 60 => r182   // comment here
+loadI 16 => r17
+store r2 => r153
+sub r48 , r136 => r86
+sub r142 , r146 => r154
+output 20
+load r10 => r172
+output 8
+add r29,r77 => r172
+add r18, r38 => r12
+loadI 4 => r30
+store r161 => r77
+load r31 => r28
+load r167 => r110
+mult r112,r194 => r50
+loadI 31 => r52   // comment here
+store r109 => r182
+loadI 44 => r52
+loadI 16 => r23
+nop
+output 20
+mult r33 , r41 => r83
+load r115 => r107
+nop
+loadI 2 => r72
+rshift r199,r72 => r65
+loadI 2 => r57
+rshift r28,r57 => r90
+loadI 44 => r62
+load r77 => r97
+sub r104,r91 => r133
+nop
+loadI 33 => r108
+loadI 32 => r122
+load r56 => r160
+loadI 8 => r199
+load r39 => r62
+store r110 => r77
+loadI 20 => r4
+store r58 => r31
+sub r87, r120 => r84
+nop
+add r34, r161 => r62
+loadI 40 => r69
+loadI 0 => r119
+rshift r89 , r119 => r46
+output 44
+add r106, r150 => r50
+loadI 1 => r42
+lshift r142,r42 => r142
+loadI 17 => r182   // comment here
+add r130, r36 => r104
+loadI 48 => r161
+loadI 46 => r187
+loadI 47 => r102
+loadI 40 => r76
+output 52
+store r67 => r8
+loadI 48 => r77
+output 40
+loadI 56 => r113
+output 60
+loadI 23 => r15
+sub r155, r162 => r119
+loadI 32 => r166
+store r79 => r92
+output 32
+loadI 16 => r121   // comment here
+loadI 0 => r97
+output 40
+mult r178, r129 => r29
+mult r143 , r74 => r101
+store r82 => r180
+loadI 13 => r182
+sub r56, r181 => r106
+load r180 => r122
+sub r58, r142 => r82
+loadI 60 => r65
+store r195 => r92
+load r121 => r13
+loadI 40 => r133
+nop
+loadI 31 => r123
+load r10 => r114
+sub r19,r102 => r181
+loadI 30 => r153
+loadI 28 => r112
+store r113 => r9
+loadI 41 => r107
+loadI 24 => r12
+sub r131, r120 => r70
+loadI 22 => r189
+sub r13, r147 => r193
+sub r102 , r49 => r186
+loadI 19 => r91
+load r113 => r112
+load r52 => r64
+load r133 => r176
+mult r23 , r183 => r181   // comment here
+loadI 16 => r36
+add r67, r60 => r157
+mult r178 , r165 => r186
+store r125 => r12
+nop   // comment here
+loadI 0 => r74
+rshift r167, r74 => r37   // comment here
+output 60
+loadI 17 => r96   // comment here
+store r58 => r185
+store r86 => r199
+loadI 36 => r85
+load r39 => r179   // comment here
+store r146 => r185
+store r59 => r117
+loadI 0 => r175
+lshift r130,r175 => r159
+loadI 13 => r30
+mult r196 , r90 => r193
+store r97 => r165   // comment here
+loadI 56 => r85
+load r23 => r42
+loadI 12 => r116
+loadI 24 => r39
+load r10 => r182
+store r147 => r6
+loadI 4 => r37
+load r121 => r43
+mult r64,r15 => r124
+store r66 => r131
+loadI 40 => r141
+output 24
+add r14, r95 => r180   // comment here
+loadI 0 => r50
+rshift r121, r50 => r128
+loadI 52 => r165
+add r185, r126 => r142
+output 40
+loadI 0 => r25
+rshift r90, r25 => r33
+loadI 0 => r109
+lshift r25,r109 => r148
+mult r177,r87 => r99
+add r108 , r129 => r105
+loadI 24 => r150
+mult r114 , r71 => r110
+output 36
+loadI 2 => r123
+rshift r67 , r123 => r3
+add r33,r18 => r41
+load r9 => r13
+loadI 16 => r26
+add r142 , r57 => r94
+sub r96,r4 => r193
+output 4
+loadI 35 => r173
+add r106, r64 => r149
+load r12 => r72
+sub r100 , r68 => r132   // comment here
+loadI 4 => r170
+loadI 28 => r149
+load r133 => r80
+mult r41 , r61 => r163
+nop
+loadI 2 => r191
+rshift r181, r191 => r186
+add r111, r160 => r162
+loadI 39 => r66   // comment here
+loadI 0 => r8
+lshift r5, r8 => r51
+mult r177 , r1 => r52
+store r78 => r6
+loadI 1 => r61
+lshift r198 , r61 => r171
+loadI 1 => r8
+lshift r186, r8 => r152
+loadI 2 => r47
+lshift r140, r47 => r171
+loadI 2 => r66
+lshift r11, r66 => r19
+output 32
+loadI 0 => r193
+lshift r119,r193 => r39
+store r38 => r10
+sub r67 , r23 => r186
+loadI 4 => r143
+load r120 => r29
+nop
+load r56 => r166   // comment here
+loadI 2 => r58
+rshift r67, r58 => r88
+loadI 2 => r133
+rshift r101,r133 => r126
+output 4
+nop
+store r72 => r85
+store r6 => r97
+loadI 44 => r155
+loadI 20 => r52
+output 4
+loadI 1 => r88
+rshift r188, r88 => r166
+output 28
+load r199 => r186
+load r115 => r138
+loadI 44 => r85
+nop
+loadI 60 => r79
+add r180 , r68 => r173
+store r70 => r22
+loadI 38 => r29
+output 0
+load r26 => r98
+store r57 => r76
+loadI 2 => r138
+rshift r10, r138 => r63
+loadI 0 => r197
+sub r141, r191 => r54
+output 24
+load r56 => r163
+loadI 44 => r35
+loadI 0 => r41
+lshift r128 , r41 => r177
+add r155,r156 => r70
+loadI 47 => r163
+loadI 8 => r55
+loadI 32 => r18
+store r42 => r113
+loadI 0 => r66
+rshift r5,r66 => r186
+loadI 0 => r145
+lshift r162,r145 => r122
+loadI 0 => r62
+mult r162, r61 => r128
+output 4
+store r160 => r31
+loadI 2 => r115
+rshift r72, r115 => r108
+loadI 2 => r45
+lshift r107 , r45 => r192
+output 48
+loadI 56 => r13
+sub r58,r87 => r166
+load r149 => r102
+load r13 => r133
+loadI 44 => r168   // comment here
+loadI 1 => r2
+rshift r188 , r2 => r126
+add r63,r18 => r152
+loadI 18 => r124
+store r66 => r113
+sub r13 , r92 => r27
+output 12
+store r51 => r10
+add r38, r148 => r57
+loadI 1 => r81
+rshift r24, r81 => r171
+loadI 0 => r11
+store r128 => r167
+loadI 24 => r190
+loadI 36 => r38
+mult r2, r113 => r192
+loadI 20 => r187
+output 56
+loadI 1 => r150
+lshift r93,r150 => r79
+load r131 => r23
+add r114,r112 => r52
+nop   // comment here
+store r145 => r92
+load r77 => r173
+sub r49, r51 => r191
+loadI 0 => r161
+lshift r64 , r161 => r59
+loadI 46 => r92
+mult r64 , r194 => r18
+nop
+store r67 => r76
+loadI 5 => r127
+output 48
+loadI 52 => r123
+loadI 1 => r113
+rshift r50 , r113 => r134   // comment here
+loadI 48 => r196
+loadI 11 => r148   // comment here
+loadI 40 => r57
+add r162,r188 => r67
+output 52
+loadI 0 => r168
+lshift r77 , r168 => r168
+load r57 => r39
+loadI 0 => r89
+lshift r61 , r89 => r140
+loadI 2 => r36
+lshift r168 , r36 => r176
+add r19,r143 => r79
+store r166 => r117
+output 52
+store r120 => r26
+add r44, r76 => r138
+sub r121, r66 => r75
+loadI 56 => r198
+output 4
+store r140 => r187
+store r116 => r4
+nop
+sub r26,r121 => r143
+output 12
+loadI 6 => r54
+loadI 44 => r91
+sub r33,r97 => r45
+load r31 => r131
+loadI 2 => r106
+rshift r128, r106 => r135
+store r98 => r194
+loadI 2 => r109
+rshift r168,r109 => r58
+loadI 2 => r37
+lshift r119 , r37 => r95
+output 32
+load r197 => r163
+nop
+loadI 1 => r170
+lshift r3,r170 => r167   // comment here
+load r12 => r129
+load r17 => r182
+sub r186 , r123 => r45
+loadI 0 => r68
+lshift r63 , r68 => r20
+load r4 => r12
+loadI 32 => r136
+load r62 => r49
+output 60
+loadI 2 => r101
+lshift r31 , r101 => r96
+loadI 32 => r166
+store r10 => r190
+loadI 1 => r91
+rshift r165,r91 => r196
+sub r149 , r100 => r123
+store r134 => r166
+mult r56 , r33 => r150   // comment here
+store r189 => r155
+load r194 => r92
+nop
+store r107 => r166
+store r50 => r120
+loadI 56 => r152
+mult r57, r161 => r16
+add r58,r10 => r48
+mult r161 , r30 => r8
+store r58 => r77
+loadI 8 => r28
+loadI 0 => r165
+load r22 => r3
+loadI 24 => r104
+load r165 => r161
+store r77 => r56
+store r113 => r57
+loadI 35 => r5
+store r157 => r35
+output 36
+sub r0 , r88 => r148
+loadI 29 => r178
+nop
+load r56 => r35
+loadI 37 => r72
+loadI 13 => r15
+loadI 36 => r128
+sub r53,r35 => r27   // comment here
+load r152 => r118
+output 24   // comment here
+store r54 => r190
+add r79, r189 => r13
+loadI 20 => r98
+add r53, r104 => r139
+load r55 => r198
+sub r128 , r96 => r106
+loadI 44 => r160
+load r197 => r15
+loadI 48 => r105
+loadI 1 => r122
+rshift r29,r122 => r183
+loadI 44 => r171
+output 48
+output 16
+loadI 28 => r119
+loadI 0 => r17
+lshift r136,r17 => r147
+store r121 => r9
+output 4
+loadI 2 => r174
+rshift r188, r174 => r109
+loadI 20 => r177
+store r81 => r187
+sub r113, r72 => r126
+loadI 1 => r98
+rshift r43 , r98 => r60
+loadI 16 => r153
+store r82 => r22
+output 48   // comment here
+loadI 1 => r116
+rshift r105 , r116 => r48
+loadI 4 => r116
+loadI 16 => r122
+loadI 38 => r90
+store r134 => r117
+sub r29, r73 => r131   // comment here
+loadI 0 => r18
+loadI 46 => r44
+add r158, r54 => r102
+loadI 5 => r162
+store r196 => r11
+load r121 => r177
+nop
+nop
+loadI 0 => r193
+load r57 => r180
+nop
+loadI 4 => r37
+store r122 => r62
+mult r178 , r173 => r105
+loadI 44 => r2
+loadI 40 => r14
+store r3 => r14
+loadI 2 => r136
+lshift r151,r136 => r145   // comment here
+loadI 33 => r110
+add r52, r105 => r152
+load r4 => r171
+sub r57,r158 => r99
+nop
+store r23 => r85
+add r193,r106 => r121
+loadI 4 => r108
+add r38, r28 => r35
+loadI 49 => r81
+output 28
+loadI 44 => r168   // comment here
+output 12
+nop
+load r199 => r74   // comment here
+store r18 => r6
+store r53 => r56
+add r107, r59 => r16
+load r56 => r82
+loadI 2 => r29
+lshift r15, r29 => r7
+loadI 40 => r14
+loadI 0 => r162
+lshift r121,r162 => r8
+sub r44 , r36 => r30
+loadI 1 => r104
+lshift r3,r104 => r82
+loadI 44 => r157
+loadI 43 => r172
+loadI 33 => r94
+loadI 30 => r50   // comment here
+loadI 40 => r117
+loadI 0 => r116
+lshift r87 , r116 => r46
+loadI 0 => r165
+rshift r157,r165 => r79
+mult r48 , r38 => r74
+sub r31, r5 => r81
+nop
+loadI 3 => r137
+load r69 => r14
+store r66 => r122
+add r70, r145 => r82
+output 28
+loadI 0 => r20
+rshift r123, r20 => r137
+output 40
+output 28
+output 0
+output 4
+output 8
+output 12
+output 16
+output 20
+output 24
+output 28
+output 32
+output 36
+output 40
+output 44
+output 48
+output 52
+output 56
+output 60
@@ -0,0 +1,51 @@
+// generated block
+//
+loadI 47 => r3
+loadI 0 => r6
+store r3 => r6
+loadI 24 => r2
+loadI 4 => r0
+store r2 => r0
+loadI 17 => r1
+loadI 8 => r3
+store r1 => r3
+loadI 51 => r3
+loadI 12 => r0
+store r3 => r0
+loadI 1 => r3
+lshift r3,r3 => r1
+loadI 30 => r4
+add r4, r1 => r1
+loadI 8 => r0
+load r0 => r2
+add r0, r1 => r3
+load r0 => r4
+output 52
+store r4 => r0
+output 60
+loadI 36 => r2
+loadI 0 => r3
+loadI 48 => r0
+store r3 => r2
+loadI 20 => r0
+loadI 20 => r6
+output 16
+loadI 1 => r1
+lshift r2, r1 => r1
+loadI 60 => r5
+output 0
+output 4
+output 8
+output 12
+output 16
+output 20
+output 24
+output 28
+output 32
+output 36
+output 40
+output 44
+output 48
+output 52
+output 56
+output 60
@@ -0,0 +1,58 @@
+#!/bin/bash
+# Runs every block in test/blocks through each allocator mode and pre-allocation pass at several
+# k and checks with the reference simulator that the output prints the same values and leaves
+# the same memory as the unallocated input, using only registers r0..r(k-1).
+#
+# Usage: test/check.sh path/to/thc path/to/sim
+thc=$1
+sim=$2
+blocks=$(dirname "$0")/blocks
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+modes=(
+    ""
+    "--alloc=color"
+    "--alloc=linear"
+    "--alloc=optimal --opt-nodes 20000"
+    "--fold"
+    "--lvn"
+    "--loads"
+    "--select"
+    "--dce"
+    "--frame"
+    "--fold --loads --lvn --select --dce --frame"
+    "--alloc=color --fold --loads --lvn --select --dce --frame"
+    "--alloc=linear --fold --loads --lvn --select --dce --frame"
+)
+
+checked=0
+failed=0
+for block in "$blocks"/*.i; do
+    name=$(basename "$block")
+    if ! "$sim" "$block" > "$work/expected"; then
+        echo "FAIL $name: the input block does not simulate"
+        checked=$((checked + 1))
+        failed=$((failed + 1))
+        continue
+    fi
+    for mode in "${modes[@]}"; do
+        for k in 3 4 5 8 16; do
+            checked=$((checked + 1))
+            # shellcheck disable=SC2086
+            if ! "$thc" $mode -k $k "$block" > "$work/out.i" 2> "$work/err"; then
+                echo "FAIL $name -k $k $mode: thc exited with an error"
+                failed=$((failed + 1))
+            elif ! "$sim" "$work/out.i" $k > "$work/actual" 2> "$work/err"; then
+                echo "FAIL $name -k $k $mode: $(cat "$work/err")"
+                failed=$((failed + 1))
+            elif ! cmp -s "$work/expected" "$work/actual"; then
+                echo "FAIL $name -k $k $mode: output or memory differs from the input block"
+                failed=$((failed + 1))
+            fi
+        done
+    done
+done
+
+echo "$((checked - failed)) of $checked checks passed"
+[ "$failed" -eq 0 ]
@@ -0,0 +1,207 @@
+// Reference ILOC simulator for make check: runs one block and prints what it observably does,
+// the values written by output followed by every word stored below the spill area, so an
+// allocated block can be compared with its input line for line.
+//
+// Usage: sim file [k]   (with k, any register outside r0..r(k-1) is an error)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+
+#define SPILL_BASE 32768    // Spill slots start here; they differ between allocators
+#define MAX_REGISTERS 65536
+#define MAX_TOKENS 8
+
+typedef struct {
+    int address;
+    int32_t value;
+} Word;
+
+static int32_t registers[MAX_REGISTERS];
+static char defined[MAX_REGISTERS];
+static Word *memory;
+static int memoryCount;
+static int memoryCap;
+static int registerLimit = MAX_REGISTERS;
+static int lineNumber;
+
+static void fail(const char *message, const char *detail) {
+    fprintf(stderr, "sim: line %d: %s %s\n", lineNumber, message, detail);
+    exit(EXIT_FAILURE);
+}
+
+// Words are kept unsorted; blocks are small enough for a linear search
+static Word *findWord(int address) {
+    for (int i = 0; i < memoryCount; i++) {
+        if (memory[i].address == address) {
+            return &memory[i];
+        }
+    }
+    return NULL;
+}
+
+static int32_t loadWord(int address) {
+    Word *word = findWord(address);
+    return word ? word->value : 0;
+}
+
+static void storeWord(int address, int32_t value) {
+    Word *word = findWord(address);
+    if (!word) {
+        if (memoryCount == memoryCap) {
+            memoryCap = memoryCap ? memoryCap * 2 : 256;
+            memory = (Word *)realloc(memory, memoryCap * sizeof(Word));
+            if (!memory) {
+                fail("out of memory", "");
+            }
+        }
+        word = &memory[memoryCount++];
+        word->address = address;
+    }
+    word->value = value;
+}
+
+static int registerNumber(const char *token) {
+    if (token[0] != 'r' || !isdigit((unsigned char)token[1])) {
+        fail("expected a register, found", token);
+    }
+    int number = atoi(token + 1);
+    if (number >= registerLimit || number >= MAX_REGISTERS) {
+        fail("register out of range:", token);
+    }
+    return number;
+}
+
+static int32_t readRegister(const char *token) {
+    int number = registerNumber(token);
+    if (!defined[number]) {
+        fail("read of undefined register", token);
+    }
+    return registers[number];
+}
+
+static void writeRegister(const char *token, int32_t value) {
+    int number = registerNumber(token);
+    registers[number] = value;
+    defined[number] = 1;
+}
+
+static int32_t constant(const char *token) {
+    char *end;
+    long long value = strtoll(token, &end, 10);
+    if (*end != '\0') {
+        fail("expected a constant, found", token);
+    }
+    return (int32_t)(uint32_t)value;
+}
+
+// Arithmetic wraps at 32 bits; shift counts use their low five bits
+static int32_t arithmetic(const char *op, int32_t a, int32_t b) {
+    uint32_t ua = (uint32_t)a;
+    if (strcmp(op, "add") == 0) {
+        return (int32_t)(ua + (uint32_t)b);
+    } else if (strcmp(op, "sub") == 0) {
+        return (int32_t)(ua - (uint32_t)b);
+    } else if (strcmp(op, "mult") == 0) {
+        return (int32_t)(ua * (uint32_t)b);
+    } else if (strcmp(op, "lshift") == 0) {
+        return (int32_t)(ua << (b & 31));
+    } else if (strcmp(op, "rshift") == 0) {
+        return a >> (b & 31);
+    }
+    fail("unknown opcode", op);
+    return 0;
+}
+
+// Splits a line into words, registers and constants; "=>" and "," are dropped
+static int tokenize(char *line, char **tokens) {
+    char *comment = strstr(line, "//");
+    if (comment) {
+        *comment = '\0';
+    }
+    int count = 0;
+    for (char *word = strtok(line, " \t\r\n,"); word; word = strtok(NULL, " \t\r\n,")) {
+        if (strcmp(word, "=>") == 0) {
+            continue;
+        }
+        if (count == MAX_TOKENS) {
+            fail("too many operands", "");
+        }
+        tokens[count++] = word;
+    }
+    return count;
+}
+
+static void run(FILE *file) {
+    char line[512];
+    char *t[MAX_TOKENS];
+    while (fgets(line, sizeof(line), file)) {
+        lineNumber++;
+        int count = tokenize(line, t);
+        if (count == 0) {
+            continue;
+        }
+        const char *op = t[0];
+        size_t length = strlen(op);
+        if (strcmp(op, "nop") == 0) {
+            continue;
+        } else if (strcmp(op, "output") == 0 && count == 2) {
+            printf("%d\n", loadWord(constant(t[1])));
+        } else if (strcmp(op, "loadI") == 0 && count == 3) {
+            writeRegister(t[2], constant(t[1]));
+        } else if (strcmp(op, "load") == 0 && count == 3) {
+            writeRegister(t[2], loadWord(readRegister(t[1])));
+        } else if (strcmp(op, "loadAI") == 0 && count == 4) {
+            writeRegister(t[3], loadWord(arithmetic("add", readRegister(t[1]), constant(t[2]))));
+        } else if (strcmp(op, "store") == 0 && count == 3) {
+            storeWord(readRegister(t[2]), readRegister(t[1]));
+        } else if (strcmp(op, "storeAI") == 0 && count == 4) {
+            storeWord(arithmetic("add", readRegister(t[2]), constant(t[3])), readRegister(t[1]));
+        } else if (count == 4 && length > 1 && op[length - 1] == 'I') {
+            char base[16];
+            if (length >= sizeof(base)) {
+                fail("unknown opcode", op);
+            }
+            memcpy(base, op, length - 1);
+            base[length - 1] = '\0';
+            writeRegister(t[3], arithmetic(base, readRegister(t[1]), constant(t[2])));
+        } else if (count == 4) {
+            writeRegister(t[3], arithmetic(op, readRegister(t[1]), readRegister(t[2])));
+        } else {
+            fail("malformed instruction", op);
+        }
+    }
+}
+
+static int byAddress(const void *a, const void *b) {
+    int x = ((const Word *)a)->address;
+    int y = ((const Word *)b)->address;
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2 || argc > 3) {
+        fprintf(stderr, "Usage: sim file [k]\n");
+        return EXIT_FAILURE;
+    }
+    FILE *file = fopen(argv[1], "r");
+    if (!file) {
+        fprintf(stderr, "sim: unable to open %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    if (argc == 3) {
+        registerLimit = atoi(argv[2]);
+    }
+    run(file);
+    fclose(file);
+
+    qsort(memory, memoryCount, sizeof(Word), byAddress);
+    for (int i = 0; i < memoryCount; i++) {
+        if (memory[i].address >= 0 && memory[i].address < SPILL_BASE) {
+            printf("mem %d %d\n", memory[i].address, memory[i].value);
+        }
+    }
+    free(memory);
+    return 0;
+}